@@ -0,0 +1,76 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example shows how to collect measurements into the library's sample buffer and drain them in
+  batches into plain arrays. Once a batch is complete, minimum, maximum, mean, reliability-weighted
+  mean and median distances are printed.
+
+  Hardware Connections:
+  - Plug the Qwiic device to your Arduino/Photon/ESP32 using a cable
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 tmf8801;
+
+// Batch arrays
+const byte batchSize = 16;
+int distances[batchSize];
+byte reliabilities[batchSize];
+unsigned long timestamps[batchSize];
+
+// Holds measurements until a whole batch is available
+TMF8801_SampleBuffer<batchSize> samples;
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start I2C interface
+  Wire.begin();
+
+  if (tmf8801.begin() == false)
+  {
+    Serial.println("TMF8801 connection failed.");
+    Serial.println("System halted.");
+    while (true);
+  }
+}
+
+void loop()
+{
+  // Store every new measurement in the sample buffer
+  samples.collectSample(tmf8801);
+
+  // Wait until a whole batch is buffered
+  if (samples.samplesAvailable() < batchSize)
+    return;
+
+  byte count = samples.readSamples(distances, reliabilities, timestamps, batchSize);
+
+  Serial.print(count);
+  Serial.print(" samples over ");
+  Serial.print(timestamps[count - 1] - timestamps[0]);
+  Serial.println(" ms");
+  Serial.print("Min: ");
+  Serial.print(TMF8801_Statistics::minimum(distances, count));
+  Serial.print(" mm, max: ");
+  Serial.print(TMF8801_Statistics::maximum(distances, count));
+  Serial.print(" mm, mean: ");
+  Serial.print(TMF8801_Statistics::mean(distances, count));
+  Serial.print(" mm, weighted mean: ");
+  Serial.print(TMF8801_Statistics::weightedMean(distances, reliabilities, count));
+  Serial.print(" mm, median: ");
+  // percentile() reorders the array, so it goes last
+  Serial.print(TMF8801_Statistics::percentile(distances, count, 50));
+  Serial.println(" mm");
+}
@@ -0,0 +1,85 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example shows how to run two sensors with overlapping fields of view without them
+  interfering with each other. The scheduler triggers a single measurement on one sensor at a time
+  and starts the next one as soon as the previous result is read, so their lasers never fire
+  together. Every 5 seconds the rate achieved by each sensor and the fraction of time a sensor was
+  measuring are printed.
+
+  Both sensors use the same I2C address, so this example needs a board with two I2C ports
+  (ESP32, Teensy, SAMD51...).
+
+  Hardware Connections:
+  - Plug the first Qwiic device to the Wire port of your board
+  - Connect the second device to the Wire1 port
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 sensorA;
+TMF8801 sensorB;
+TMF8801_Scheduler scheduler;
+TMF8801* sensors[] = { &sensorA, &sensorB };
+
+unsigned long lastReport;
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start both I2C interfaces
+  Wire.begin();
+  Wire1.begin();
+
+  if (sensorA.begin(DEFAULT_I2C_ADDR, Wire) == false || sensorB.begin(DEFAULT_I2C_ADDR, Wire1) == false)
+  {
+    Serial.println("TMF8801 connection failed.");
+    Serial.println("System halted.");
+    while (true);
+  }
+
+  scheduler.addSensor(sensorA);
+  scheduler.addSensor(sensorB);
+
+  // Skip a sensor that doesn't answer within 100 ms
+  scheduler.setSlotTimeout(100);
+  scheduler.begin();
+
+  lastReport = millis();
+}
+
+void loop()
+{
+  byte index = scheduler.update();
+  if (index != SCHEDULER_NO_RESULT)
+  {
+    Serial.print("Sensor ");
+    Serial.print(index);
+    Serial.print(": ");
+    Serial.print(sensors[index]->getLastDistance());
+    Serial.println(" mm");
+  }
+
+  if (millis() - lastReport > 5000)
+  {
+    Serial.print("Rate A: ");
+    Serial.print(scheduler.getMeasurementRate(0));
+    Serial.print(" Hz, rate B: ");
+    Serial.print(scheduler.getMeasurementRate(1));
+    Serial.print(" Hz, utilisation: ");
+    Serial.print(scheduler.getSlotUtilisation() * 100);
+    Serial.println(" %");
+    scheduler.resetStatistics();
+    lastReport = millis();
+  }
+}
@@ -0,0 +1,87 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example shows how several independent parts of a sketch can consume the same measurements
+  while the sensor is read only once per result. The sample buffer's collectSample() is the only
+  function touching the bus. A "control" consumer reacts to every new sample, while a "logger" consumer prints its
+  backlog once per second. Each one keeps its own cursor into the sample buffer and is told how
+  many samples it missed if it falls too far behind.
+
+  Hardware Connections:
+  - Plug the Qwiic device to your Arduino/Photon/ESP32 using a cable
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 tmf8801;
+
+// Measurements shared by all consumers
+const byte sampleCapacity = 16;
+TMF8801_SampleBuffer<sampleCapacity> samples;
+
+// One cursor per consumer
+TMF8801_SampleCursor controlCursor;
+TMF8801_SampleCursor loggerCursor;
+
+unsigned long lastLog;
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start I2C interface
+  Wire.begin();
+
+  // Set the LED_BUILTIN as output
+  pinMode(LED_BUILTIN, OUTPUT);
+
+  if (tmf8801.begin() == false)
+  {
+    Serial.println("TMF8801 connection failed.");
+    Serial.println("System halted.");
+    while (true);
+  }
+
+  samples.initSampleCursor(controlCursor);
+  samples.initSampleCursor(loggerCursor);
+  lastLog = millis();
+}
+
+void loop()
+{
+  // The only bus access
+  samples.collectSample(tmf8801);
+
+  // Control consumer: light the LED when something is closer than 200 mm
+  int distance;
+  while (samples.readSamples(controlCursor, &distance, NULL, NULL, 1) == 1)
+    digitalWrite(LED_BUILTIN, distance < 200 ? HIGH : LOW);
+
+  // Logger consumer: print everything collected during the last second
+  if (millis() - lastLog >= 1000)
+  {
+    int distances[sampleCapacity];
+    unsigned long timestamps[sampleCapacity];
+    byte count = samples.readSamples(loggerCursor, distances, NULL, timestamps, sampleCapacity);
+    for (byte i = 0; i < count; i++)
+    {
+      Serial.print(timestamps[i]);
+      Serial.print(" ms: ");
+      Serial.print(distances[i]);
+      Serial.println(" mm");
+    }
+    Serial.print("Logger missed ");
+    Serial.print(loggerCursor.dropped);
+    Serial.println(" samples so far");
+    lastLog = millis();
+  }
+}
@@ -0,0 +1,121 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example compares a fixed measurement rate with the adaptive sampler. Each mode runs for
+  30 seconds, then one CSV line is printed with the number of results produced, the I2C traffic and
+  the estimated fraction of time the sensor spent ranging. The sensor is polled every 10 ms in both
+  modes, so the traffic difference comes from result reads and timing changes. Leave the scene still
+  for a while and then wave a hand in front of the sensor to see the sampler back off and ramp up again.
+
+  To compare both modes without hardware, run make adaptive-sampling in extras/simulator. It replays
+  a still scene followed by a moving hand against a simulated device.
+
+  Hardware Connections:
+  - Plug the Qwiic device to your Arduino/Photon/ESP32 using a cable
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 tmf8801;
+TMF8801_AdaptiveSampler sampler;
+
+// Length of each run in milliseconds
+const unsigned long runTime = 30000;
+
+// Fixed mode settings: fastest period with the 900k iterations of the datasheet default mode
+const byte fixedPeriod = 33;
+const unsigned int fixedIterations = 900;
+
+// Both modes read the sensor at the same rate
+const unsigned long pollInterval = 10;
+
+bool adaptive = false;
+unsigned long runStart;
+unsigned long fixedSamples;
+float dutyTime;
+unsigned long lastPoll;
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start I2C interface
+  Wire.begin();
+
+  if (tmf8801.begin() == false)
+  {
+    Serial.println("TMF8801 connection failed.");
+    Serial.println("System halted.");
+    while (true);
+  }
+
+  Serial.println("mode,seconds,samples,transactions,bytes,duty_cycle");
+  startRun();
+}
+
+void loop()
+{
+  unsigned long now = millis();
+  if (now - lastPoll < pollInterval)
+    return;
+
+  // Integrate the duty cycle of the settings that were active since the last poll
+  dutyTime += dutyCycle() * (now - lastPoll);
+  lastPoll = now;
+
+  if (adaptive)
+    sampler.update(tmf8801);
+  else if (tmf8801.readNewMeasurement())
+    fixedSamples++;
+
+  if (millis() - runStart >= runTime)
+  {
+    TMF8801_BusStatistics statistics = tmf8801.getBusStatistics();
+    Serial.print(adaptive ? "adaptive" : "fixed");
+    Serial.print(",");
+    Serial.print(runTime / 1000);
+    Serial.print(",");
+    Serial.print(adaptive ? sampler.getSamples() : fixedSamples);
+    Serial.print(",");
+    Serial.print(statistics.transactions);
+    Serial.print(",");
+    Serial.print(statistics.bytesWritten + statistics.bytesRead);
+    Serial.print(",");
+    Serial.println(dutyTime / (lastPoll - runStart), 3);
+
+    // Alternate between both modes
+    adaptive = !adaptive;
+    startRun();
+  }
+}
+
+// Restores fixed timing, resets the sampler and clears counters for a new run
+void startRun()
+{
+  tmf8801.setMeasurementTiming(fixedPeriod, fixedIterations);
+  sampler = TMF8801_AdaptiveSampler();
+  sampler.setPeriodBounds(fixedPeriod, 250);
+  sampler.setIterationBounds(300, fixedIterations);
+  tmf8801.resetBusStatistics();
+  fixedSamples = 0;
+  dutyTime = 0;
+  runStart = millis();
+  lastPoll = runStart;
+}
+
+// Returns estimated fraction of time the sensor spends ranging with its current settings
+float dutyCycle()
+{
+  float rangingTime = (float)tmf8801.getIterations() * RANGING_TIME_900K / 900;
+  float period = tmf8801.getRepetitionPeriod();
+  return rangingTime >= period ? 1 : rangingTime / period;
+}
@@ -0,0 +1,74 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example shows how to capture every application and system register in a few burst reads
+  while the sensor keeps measuring. Every 5 seconds a few decoded fields are printed, followed by
+  the compact serialized snapshot as a hex string ready to be attached to a fault report.
+
+  Hardware Connections:
+  - Plug the Qwiic device to your Arduino/Photon/ESP32 using a cable
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 tmf8801;
+TMF8801_Snapshot snapshot;
+byte serialized[SNAPSHOT_SERIALIZED_LENGTH];
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start I2C interface
+  Wire.begin();
+
+  if (tmf8801.begin() == false)
+  {
+    Serial.println("TMF8801 connection failed.");
+    Serial.println("System halted.");
+    while (true);
+  }
+}
+
+void loop()
+{
+  tmf8801.getSnapshot(snapshot);
+
+  Serial.print("App 0x");
+  Serial.print(snapshot.appId, HEX);
+  Serial.print(" v");
+  Serial.print(snapshot.appVersionMajor);
+  Serial.print(".");
+  Serial.print(snapshot.appVersionMinor);
+  Serial.print(".");
+  Serial.print(snapshot.appVersionPatch);
+  Serial.print(", status 0x");
+  Serial.print(snapshot.status, HEX);
+  Serial.print(", result #");
+  Serial.print(snapshot.resultNumber);
+  Serial.print(": ");
+  Serial.print(snapshot.distance);
+  Serial.print(" mm, object hits ");
+  Serial.println(snapshot.objectHits);
+
+  // Print the serialized snapshot as hex
+  byte length = tmf8801.serializeSnapshot(snapshot, serialized);
+  for (byte i = 0; i < length; i++)
+  {
+    if (serialized[i] < 0x10)
+      Serial.print("0");
+    Serial.print(serialized[i], HEX);
+  }
+  Serial.println();
+
+  delay(5000);
+}
@@ -0,0 +1,110 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example shows how to download an application patch through the TMF8801 bootloader. The patch
+  is stored in flash as Intel HEX, so it also works on boards with little RAM. After the download the
+  patched application version is printed along with the transfer throughput and the same bus cost
+  columns printed by Example7-BusBenchmark, so the download can be compared between library versions.
+
+  Paste the Intel HEX patch provided by ams into patchImage below before running this example.
+
+  Hardware Connections:
+  - Plug the Qwiic device to your Arduino/Photon/ESP32 using a cable
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 tmf8801;
+TMF8801_PatchLoader patchLoader(tmf8801);
+
+// Intel HEX patch image. Every record goes on its own line ending with \n.
+const char patchImage[] PROGMEM =
+  "";
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start I2C interface
+  Wire.begin();
+
+  if (tmf8801.begin() == false)
+  {
+    Serial.println("TMF8801 connection failed.");
+    Serial.println("System halted.");
+    while (true);
+  }
+
+  printVersion();
+
+  Serial.println("Downloading patch...");
+  tmf8801.resetBusStatistics();
+  unsigned long start = micros();
+  bool ready = patchLoader.downloadIntelHex_P(patchImage);
+  unsigned long wallTime = micros() - start;
+
+  if (ready == false)
+  {
+    Serial.print("Download failed with error ");
+    Serial.print(tmf8801.getLastError());
+    Serial.println(". Was a patch image pasted into patchImage?");
+    Serial.println("System halted.");
+    while (true);
+  }
+
+  printVersion();
+  Serial.print(patchLoader.getBytesDownloaded());
+  Serial.print(" bytes transferred in ");
+  Serial.print(patchLoader.getDownloadTime());
+  Serial.print(" ms, throughput: ");
+  Serial.print(patchLoader.getThroughput());
+  Serial.println(" bytes/s");
+
+  // Bus cost of the whole download, including reset and application start
+  TMF8801_BusStatistics statistics = tmf8801.getBusStatistics();
+  Serial.println("function,transactions,bytes,wire_us_100k,wire_us_400k,wire_us_1m,delay_ms,wall_us");
+  Serial.print("downloadIntelHex_P,");
+  Serial.print(statistics.transactions);
+  Serial.print(",");
+  Serial.print(statistics.bytesWritten + statistics.bytesRead);
+  Serial.print(",");
+  Serial.print(tmf8801.getBusTime(100000));
+  Serial.print(",");
+  Serial.print(tmf8801.getBusTime(400000));
+  Serial.print(",");
+  Serial.print(tmf8801.getBusTime(1000000));
+  Serial.print(",");
+  Serial.print(statistics.delayMillis);
+  Serial.print(",");
+  Serial.println(wallTime);
+}
+
+void loop()
+{
+  // The patched application measures just like the built-in one
+  if (tmf8801.dataAvailable())
+  {
+    Serial.print("Distance: ");
+    Serial.print(tmf8801.getDistance());
+    Serial.println(" mm");
+  }
+  delay(100);
+}
+
+// Prints the version of the running application
+void printVersion()
+{
+  Serial.print("Application version: ");
+  Serial.print(tmf8801.getApplicationVersionMajor());
+  Serial.print(".");
+  Serial.println(tmf8801.getApplicationVersionMinor());
+}
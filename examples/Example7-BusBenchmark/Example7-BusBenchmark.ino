@@ -0,0 +1,142 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example calls every public TMF8801 function once and reports the I2C traffic each one generates.
+  For every call it prints, as CSV, the number of bus transactions, the number of bytes transferred,
+  the modelled wire time at 100 kHz, 400 kHz and 1 MHz, the time spent in delay() and the measured
+  wall time. Capture the serial output to a file and compare it between library versions to catch
+  functions that became more expensive.
+
+  The same CSV can be produced without hardware by running this sketch against a simulated device:
+  run make bus-benchmark in extras/simulator. Simulated time is deterministic, so that output can be
+  diffed directly between library versions.
+
+  Hardware Connections:
+  - Plug the Qwiic device to your Arduino/Photon/ESP32 using a cable
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 tmf8801;
+TMF8801_SampleBuffer<16> samples;
+
+// Scratch buffers used by the benchmarked calls
+byte registerBuffer[4];
+byte calibrationBuffer[CALIBRATION_DATA_LENGTH];
+int sampleDistances[16];
+byte sampleReliabilities[16];
+unsigned long sampleTimestamps[16];
+TMF8801_SampleCursor sampleCursor;
+TMF8801_Snapshot snapshot;
+byte snapshotBuffer[SNAPSHOT_SERIALIZED_LENGTH];
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start I2C interface
+  Wire.begin();
+
+  // CSV header
+  Serial.println("function,transactions,bytes,wire_us_100k,wire_us_400k,wire_us_1m,delay_ms,wall_us");
+
+  // begin() must succeed before the remaining functions can be measured
+  tmf8801.resetBusStatistics();
+  unsigned long start = micros();
+  bool ready = tmf8801.begin();
+  printResult("begin", micros() - start);
+  if (ready == false)
+  {
+    Serial.println("TMF8801 connection failed. System halted.");
+    while (true);
+  }
+
+  benchmark("isConnected", []() { tmf8801.isConnected(); });
+  benchmark("getStatus", []() { tmf8801.getStatus(); });
+  benchmark("dataAvailable", []() { tmf8801.dataAvailable(); });
+  benchmark("getDistance", []() { tmf8801.getDistance(); });
+  benchmark("getMeasurementReliability", []() { tmf8801.getMeasurementReliability(); });
+  benchmark("getMeasurementStatus", []() { tmf8801.getMeasurementStatus(); });
+  benchmark("getMeasurementNumber", []() { tmf8801.getMeasurementNumber(); });
+  benchmark("measurementEnabled", []() { tmf8801.measurementEnabled(); });
+  benchmark("enableInterrupt", []() { tmf8801.enableInterrupt(); });
+  benchmark("clearInterruptFlag", []() { tmf8801.clearInterruptFlag(); });
+  benchmark("disableInterrupt", []() { tmf8801.disableInterrupt(); });
+  benchmark("setGPIO0Mode", []() { tmf8801.setGPIO0Mode(MODE_LOW_OUTPUT); });
+  benchmark("getGPIO0Mode", []() { tmf8801.getGPIO0Mode(); });
+  benchmark("setGPIO1Mode", []() { tmf8801.setGPIO1Mode(MODE_LOW_OUTPUT); });
+  benchmark("getGPIO1Mode", []() { tmf8801.getGPIO1Mode(); });
+  benchmark("getRegisterValue", []() { tmf8801.getRegisterValue(REGISTER_STATUS); });
+  benchmark("setRegisterValue", []() { tmf8801.setRegisterValue(REGISTER_INT_ENAB, 0x00); });
+  benchmark("getRegisterMultipleValues", []() { tmf8801.getRegisterMultipleValues(REGISTER_RESULT_NUMBER, registerBuffer, sizeof(registerBuffer)); });
+  benchmark("setRegisterMultipleValues", []() { tmf8801.setRegisterMultipleValues(REGISTER_INT_ENAB, registerBuffer, 1); });
+  benchmark("getHardwareVersion", []() { tmf8801.getHardwareVersion(); });
+  benchmark("getApplicationVersionMajor", []() { tmf8801.getApplicationVersionMajor(); });
+  benchmark("getApplicationVersionMinor", []() { tmf8801.getApplicationVersionMinor(); });
+  benchmark("getSerialNumber", []() { tmf8801.getSerialNumber(); });
+  benchmark("trigger", []() { tmf8801.trigger(); });
+  benchmark("poll", []() { while (tmf8801.poll() == false); });
+  benchmark("getSingleShotLatency", []() { tmf8801.getSingleShotLatency(); });
+  benchmark("stopMeasurement", []() { tmf8801.stopMeasurement(); });
+  benchmark("setMeasurementTiming", []() { tmf8801.setMeasurementTiming(tmf8801.getRepetitionPeriod(), tmf8801.getIterations()); });
+  benchmark("getRepetitionPeriod", []() { tmf8801.getRepetitionPeriod(); });
+  benchmark("getIterations", []() { tmf8801.getIterations(); });
+  benchmark("startContinuousMeasurement", []() { tmf8801.startContinuousMeasurement(); });
+  benchmark("initSampleCursor", []() { samples.initSampleCursor(sampleCursor); });
+  benchmark("collectSample", []() { samples.collectSample(tmf8801); });
+  benchmark("samplesAvailable", []() { samples.samplesAvailable(); });
+  benchmark("samplesAvailable(cursor)", []() { samples.samplesAvailable(sampleCursor); });
+  benchmark("readSamples(cursor)", []() { samples.readSamples(sampleCursor, sampleDistances, sampleReliabilities, sampleTimestamps, 16); });
+  benchmark("readSamples", []() { samples.readSamples(sampleDistances, sampleReliabilities, sampleTimestamps, 16); });
+  benchmark("getSnapshot", []() { tmf8801.getSnapshot(snapshot); });
+  benchmark("serializeSnapshot", []() { tmf8801.serializeSnapshot(snapshot, snapshotBuffer); });
+  benchmark("getCalibrationData", []() { tmf8801.getCalibrationData(calibrationBuffer); });
+  benchmark("setCalibrationData", []() { tmf8801.setCalibrationData(tmf8801.calibrationData); });
+  benchmark("resetDevice", []() { tmf8801.resetDevice(); });
+  benchmark("wakeUpDevice", []() { tmf8801.wakeUpDevice(); });
+
+  Serial.println("done");
+}
+
+void loop()
+{
+}
+
+// Runs a single call with cleared bus statistics and prints its cost
+void benchmark(const char* name, void (*call)())
+{
+  tmf8801.resetBusStatistics();
+  unsigned long start = micros();
+  call();
+  printResult(name, micros() - start);
+}
+
+// Prints one CSV line with the bus statistics accumulated since the last reset
+void printResult(const char* name, unsigned long wallTime)
+{
+  TMF8801_BusStatistics statistics = tmf8801.getBusStatistics();
+  Serial.print(name);
+  Serial.print(",");
+  Serial.print(statistics.transactions);
+  Serial.print(",");
+  Serial.print(statistics.bytesWritten + statistics.bytesRead);
+  Serial.print(",");
+  Serial.print(tmf8801.getBusTime(100000));
+  Serial.print(",");
+  Serial.print(tmf8801.getBusTime(400000));
+  Serial.print(",");
+  Serial.print(tmf8801.getBusTime(1000000));
+  Serial.print(",");
+  Serial.print(statistics.delayMillis);
+  Serial.print(",");
+  Serial.println(wallTime);
+}
@@ -0,0 +1,85 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example shows how to take a single measurement on demand instead of ranging continuously.
+  A measurement is triggered every time the trigger pin is pulled low. The device stays idle between
+  measurements, so the result is always fresh and power consumption is lower than in continuous mode.
+  The time between the trigger and the result being available is printed along with the distance.
+
+  Hardware Connections:
+  - Plug the Qwiic device to your Arduino/Photon/ESP32 using a cable
+  - Connect a push button between Arduino pin 3 and ground
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 tmf8801;
+const byte triggerPin = 3;
+
+// A measurement at default settings takes about 33 ms. Give up if no result arrives well after that.
+const unsigned long resultTimeout = 500;
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start I2C interface
+  Wire.begin();
+
+  pinMode(triggerPin, INPUT_PULLUP);
+
+  if (tmf8801.begin() == true)
+  {
+    Serial.println("TMF8801 connected. Pull the trigger pin low to measure.");
+  }
+  else
+  {
+    Serial.println("TMF8801 connection failed.");
+    Serial.println("System halted.");
+    while (true);
+  }
+}
+
+void loop()
+{
+  // Start a single measurement when the trigger pin is pulled low
+  if (digitalRead(triggerPin) == LOW)
+  {
+    tmf8801.trigger();
+
+    // poll() returns true once the result is ready. With enableInterrupt() the INT pin
+    // also goes low at that moment, so poll() can be called from an interrupt flag instead.
+    unsigned long start = millis();
+    bool ready = false;
+    while (ready == false && millis() - start < resultTimeout)
+      ready = tmf8801.poll();
+
+    if (ready == true)
+    {
+      // poll() has already read the result, so there is no need to access the bus again
+      Serial.print("Distance: ");
+      Serial.print(tmf8801.getLastDistance());
+      Serial.print(" mm, latency: ");
+      Serial.print(tmf8801.getSingleShotLatency());
+      Serial.println(" us");
+    }
+    else
+    {
+      Serial.println("No result received.");
+      tmf8801.stopMeasurement();
+    }
+
+    // Wait until the trigger pin is released
+    while (digitalRead(triggerPin) == LOW);
+  }
+}
+
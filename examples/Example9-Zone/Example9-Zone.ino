@@ -0,0 +1,92 @@
+/*
+  Using the TMF8801 Time-of-Flight sensor
+  SparkFun Electronics
+  Date: October 18th, 2026
+  SparkFun code, firmware, and software is released under the MIT License. Please see LICENSE.md for further details.
+  Feel like supporting our work? Buy a board from SparkFun!
+  https://www.sparkfun.com/products/17716
+
+  This example shows how to report only when a target enters or leaves a distance zone instead of
+  printing every sample. The zone spans 100 mm to 300 mm. A target must move 20 mm beyond the zone
+  to leave it and every change must last 200 ms before it is reported, so noise around the edges
+  does not generate events. Samples with a reliability below 10 are ignored.
+  GPIO0 is driven high while a target is inside the zone.
+
+  Hardware Connections:
+  - Plug the Qwiic device to your Arduino/Photon/ESP32 using a cable
+  - Optionally attach a LED anode to GPIO0 through a 1k ohm resistor and it's cathode to ground
+  - Open a serial monitor at 115200bps
+*/
+
+#include <Wire.h>
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+TMF8801 tmf8801;
+TMF8801_Zone zone;
+
+// Results arrive every 100 ms, so there is no point in reading the sensor much more often
+const unsigned long pollInterval = 10;
+unsigned long lastPoll = 0;
+
+void setup()
+{
+  // Start serial @ 115200 bps and wait until it's ready
+  Serial.begin(115200);
+  while (!Serial) {}
+
+  // Start I2C interface
+  Wire.begin();
+
+  if (tmf8801.begin() == false)
+  {
+    Serial.println("TMF8801 connection failed.");
+    Serial.println("System halted.");
+    while (true);
+  }
+
+  // Configure the zone
+  zone.setBand(100, 300);
+  zone.setHysteresis(20);
+  zone.setMinimumDwell(200);
+  zone.setMinimumReliability(10);
+
+  // Report distance changes of 50 mm or more while the target stays inside
+  zone.setChangeThreshold(50);
+
+  zone.onEvent(zoneEvent);
+  zone.attachOutput(tmf8801, 0);
+}
+
+void loop()
+{
+  // Every new result is fed to the zone, which calls zoneEvent() only when something happens
+  if (millis() - lastPoll >= pollInterval)
+  {
+    lastPoll = millis();
+    zone.update(tmf8801);
+  }
+}
+
+// This function will be called on every zone event
+void zoneEvent(byte event, int distance)
+{
+  switch (event)
+  {
+  case ZONE_EVENT_ENTER:
+    Serial.print("Target entered zone at ");
+    break;
+
+  case ZONE_EVENT_EXIT:
+    Serial.print("Target left zone at ");
+    break;
+
+  case ZONE_EVENT_CHANGED:
+    Serial.print("Target moved to ");
+    break;
+
+  default:
+    return;
+  }
+  Serial.print(distance);
+  Serial.println(" mm");
+}
@@ -0,0 +1,78 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file runs Example13-AdaptiveSampling against the simulated TMF8801.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "SimulatedTMF8801.h"
+
+// Prototypes the Arduino IDE generates for the sketch
+void startRun();
+float dutyCycle();
+
+#include "../../examples/Example13-AdaptiveSampling/Example13-AdaptiveSampling.ino"
+
+SimulatedTMF8801 device;
+
+// Still target at 800 mm for 20 seconds, then a hand moving between 200 and 600 mm at
+// 1 m/s for 10 seconds. Each run of the example sees the same 30 second script.
+void scene(unsigned long time, unsigned int& distance, byte& reliability)
+{
+	unsigned long phase = (time - runStart) % runTime;
+	if (phase < 20000)
+	{
+		distance = 800;
+		reliability = 40;
+		return;
+	}
+
+	phase = (phase - 20000) % 800;
+	distance = phase < 400 ? 200 + phase : 600 - (phase - 400);
+	reliability = 20;
+}
+
+// Prints results and ranging time counted by the device itself during the run that just ended
+void printDeviceRun(unsigned long& lastCount, unsigned long& lastActive)
+{
+	unsigned long count = device.getMeasurementCount();
+	unsigned long active = device.getActiveTime();
+	Serial.print("device,");
+	Serial.print(count - lastCount);
+	Serial.print(",");
+	Serial.println((active - lastActive) / (runTime * 1000.0), 3);
+	lastCount = count;
+	lastActive = active;
+}
+
+int main()
+{
+	device.setScene(scene);
+	Wire.attach(device);
+	setup();
+
+	// Run the fixed and the adaptive mode once each
+	unsigned long lastCount = device.getMeasurementCount();
+	unsigned long lastActive = device.getActiveTime();
+	for (byte run = 0; run < 2; run++)
+	{
+		bool mode = adaptive;
+		while (adaptive == mode)
+			loop();
+		printDeviceRun(lastCount, lastActive);
+	}
+	return 0;
+}
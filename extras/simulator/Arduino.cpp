@@ -0,0 +1,151 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file provides the subset of the Arduino core needed to run the library on a host.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+#include <stdio.h>
+
+HardwareSerial Serial;
+
+// Simulated time in nanoseconds
+static unsigned long long now = 0;
+
+void simulatorAdvance(unsigned long long nanoseconds)
+{
+	now += nanoseconds;
+}
+
+unsigned long long simulatorTime()
+{
+	return now;
+}
+
+unsigned long millis()
+{
+	now += 1000;
+	return (unsigned long)(now / 1000000ULL);
+}
+
+unsigned long micros()
+{
+	now += 1000;
+	return (unsigned long)(now / 1000ULL);
+}
+
+void delay(unsigned long milliseconds)
+{
+	now += milliseconds * 1000000ULL;
+}
+
+void delayMicroseconds(unsigned int microseconds)
+{
+	now += microseconds * 1000ULL;
+}
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void digitalWrite(uint8_t, uint8_t)
+{
+}
+
+int digitalRead(uint8_t)
+{
+	return HIGH;
+}
+
+void HardwareSerial::begin(unsigned long)
+{
+}
+
+size_t HardwareSerial::print(const char* text)
+{
+	return fputs(text, stdout) < 0 ? 0 : strlen(text);
+}
+
+size_t HardwareSerial::print(char value)
+{
+	return putchar(value) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::print(int value, int base)
+{
+	return print((long)value, base);
+}
+
+size_t HardwareSerial::print(unsigned int value, int base)
+{
+	return print((unsigned long)value, base);
+}
+
+size_t HardwareSerial::print(long value, int base)
+{
+	if (base == DEC)
+		return printf("%ld", value);
+	return print((unsigned long)value, base);
+}
+
+size_t HardwareSerial::print(unsigned long value, int base)
+{
+	return printf(base == HEX ? "%lX" : "%lu", value);
+}
+
+size_t HardwareSerial::print(double value, int digits)
+{
+	return printf("%.*f", digits, value);
+}
+
+size_t HardwareSerial::println()
+{
+	return print("\r\n");
+}
+
+size_t HardwareSerial::println(const char* text)
+{
+	return print(text) + println();
+}
+
+size_t HardwareSerial::println(char value)
+{
+	return print(value) + println();
+}
+
+size_t HardwareSerial::println(int value, int base)
+{
+	return print(value, base) + println();
+}
+
+size_t HardwareSerial::println(unsigned int value, int base)
+{
+	return print(value, base) + println();
+}
+
+size_t HardwareSerial::println(long value, int base)
+{
+	return print(value, base) + println();
+}
+
+size_t HardwareSerial::println(unsigned long value, int base)
+{
+	return print(value, base) + println();
+}
+
+size_t HardwareSerial::println(double value, int digits)
+{
+	return print(value, digits) + println();
+}
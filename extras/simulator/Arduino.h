@@ -0,0 +1,97 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file provides the subset of the Arduino core needed to run the library on a host.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_SIMULATOR_ARDUINO__
+#define __TMF8801_SIMULATOR_ARDUINO__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARDUINO 10819
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+#define LED_BUILTIN 13
+
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+
+#define constrain(amount, low, high) ((amount) < (low) ? (low) : ((amount) > (high) ? (high) : (amount)))
+
+// Time is simulated. It advances with every bus transaction, every delay() and by one
+// microsecond on every millis() or micros() call, so busy loops always make progress and
+// runs are fully deterministic.
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long milliseconds);
+void delayMicroseconds(unsigned int microseconds);
+
+// Advances simulated time by nanoseconds
+void simulatorAdvance(unsigned long long nanoseconds);
+
+// Returns simulated time in nanoseconds
+unsigned long long simulatorTime();
+
+// Pins are not simulated. Inputs read HIGH, which means "not pressed" for INPUT_PULLUP buttons.
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+// Serial port writing to standard output
+class HardwareSerial
+{
+public:
+	void begin(unsigned long baud);
+	operator bool() { return true; }
+
+	size_t print(const char* text);
+	size_t print(char value);
+	size_t print(int value, int base = DEC);
+	size_t print(unsigned int value, int base = DEC);
+	size_t print(long value, int base = DEC);
+	size_t print(unsigned long value, int base = DEC);
+	size_t print(double value, int digits = 2);
+
+	size_t println();
+	size_t println(const char* text);
+	size_t println(char value);
+	size_t println(int value, int base = DEC);
+	size_t println(unsigned int value, int base = DEC);
+	size_t println(long value, int base = DEC);
+	size_t println(unsigned long value, int base = DEC);
+	size_t println(double value, int digits = 2);
+};
+
+extern HardwareSerial Serial;
+
+// Entry points of the sketch run by the simulator
+void setup();
+void loop();
+
+#endif
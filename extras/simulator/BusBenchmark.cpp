@@ -0,0 +1,36 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file runs Example7-BusBenchmark against the simulated TMF8801.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "SimulatedTMF8801.h"
+
+// Prototypes the Arduino IDE generates for the sketch
+void benchmark(const char* name, void (*call)());
+void printResult(const char* name, unsigned long wallTime);
+
+#include "../../examples/Example7-BusBenchmark/Example7-BusBenchmark.ino"
+
+SimulatedTMF8801 device;
+
+int main()
+{
+	Wire.attach(device);
+	setup();
+	return 0;
+}
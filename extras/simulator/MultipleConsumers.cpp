@@ -0,0 +1,57 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file runs Example12-MultipleConsumers against the simulated TMF8801.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "SimulatedTMF8801.h"
+
+#include "../../examples/Example12-MultipleConsumers/Example12-MultipleConsumers.ino"
+
+// Simulated run time in milliseconds
+const unsigned long simulationTime = 5000;
+
+SimulatedTMF8801 device;
+
+// Target moving between 100 and 400 mm and back every two seconds
+void scene(unsigned long time, unsigned int& distance, byte& reliability)
+{
+	unsigned long phase = time % 2000;
+	distance = phase < 1000 ? 100 + phase * 3 / 10 : 400 - (phase - 1000) * 3 / 10;
+	reliability = 40;
+}
+
+int main()
+{
+	device.setScene(scene);
+	Wire.attach(device);
+	setup();
+
+	unsigned long start = millis();
+	while (millis() - start < simulationTime)
+		loop();
+
+	// Consumers never touch the bus, so every result reaches them through the single collectSample() call
+	TMF8801_BusStatistics statistics = tmf8801.getBusStatistics();
+	Serial.print("Device produced ");
+	Serial.print(device.getMeasurementCount());
+	Serial.print(" results, control consumer is at sample ");
+	Serial.print(controlCursor.position);
+	Serial.print(", bus transactions ");
+	Serial.println(statistics.transactions);
+	return 0;
+}
@@ -0,0 +1,286 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file models the TMF8801 register map so examples can run on a host without hardware.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SimulatedTMF8801.h"
+#include "SparkFun_TMF8801_Constants.h"
+
+// Ranging time of the default 900k iterations in nanoseconds
+const unsigned long long SIMULATOR_RANGING_TIME = 33000000ULL;
+const unsigned int SIMULATOR_DEFAULT_ITERATIONS = 900;
+
+// Application version reported once the measurement application is loaded
+const byte SIMULATOR_APP_MAJOR = 0x01;
+const byte SIMULATOR_APP_MINOR = 0x0C;
+
+// Values returned by the factory calibration and serial number commands
+const byte SIMULATOR_CALIBRATION[CALIBRATION_DATA_LENGTH] = { 0xC1, 0x22, 0x0, 0x1C, 0x9, 0x40, 0x8C, 0x98, 0xA, 0x15, 0xCE, 0x9C, 0x1, 0xFC };
+const unsigned int SIMULATOR_SERIAL_NUMBER = 0x1234;
+
+// Die temperature reported in STATE_DATA_10
+const byte SIMULATOR_TEMPERATURE = 25;
+
+SimulatedTMF8801::SimulatedTMF8801(byte address)
+{
+	this->address = address;
+	reset();
+}
+
+void SimulatedTMF8801::setScene(SimulatorScene newScene)
+{
+	scene = newScene;
+}
+
+byte SimulatedTMF8801::getAddress()
+{
+	return address;
+}
+
+unsigned long SimulatedTMF8801::getMeasurementCount()
+{
+	update();
+	return measurementCount;
+}
+
+unsigned long SimulatedTMF8801::getActiveTime()
+{
+	update();
+	return (unsigned long)(activeTime / 1000ULL);
+}
+
+void SimulatedTMF8801::reset()
+{
+	memset(registers, 0, sizeof(registers));
+	registers[REGISTER_APPID] = BOOTLOADER;
+	registers[REGISTER_ENABLE_REG] = 0x41;
+	registers[REGISTER_ID] = CHIP_ID_NUMBER;
+	registers[REGISTER_REVID] = 0x01;
+	registers[REGISTER_BL_CMD_STAT] = BL_STATUS_READY;
+	applicationRunning = false;
+	ranging = false;
+}
+
+void SimulatedTMF8801::update()
+{
+	unsigned long long now = simulatorTime();
+	while (ranging && nextResultTime <= now)
+	{
+		produceResult(nextResultTime);
+
+		// A repetition period of zero is a single measurement
+		if (resultInterval == 0)
+			ranging = false;
+		else
+			nextResultTime += resultInterval;
+	}
+}
+
+void SimulatedTMF8801::produceResult(unsigned long long time)
+{
+	unsigned int distance = 250;
+	byte reliability = 63;
+	if (scene != NULL)
+		scene((unsigned long)(time / 1000000ULL), distance, reliability);
+
+	registers[REGISTER_REGISTER_CONTENTS] = COMMAND_RESULT;
+	registers[REGISTER_TID]++;
+	registers[REGISTER_RESULT_NUMBER]++;
+	registers[REGISTER_RESULT_INFO] = reliability & 0x3f;
+	registers[REGISTER_DISTANCE_PEAK_0] = distance & 0xff;
+	registers[REGISTER_DISTANCE_PEAK_1] = distance >> 8;
+
+	// System clock counts in 0.2 us steps, bit 0 flags it as valid
+	unsigned long sysClock = (unsigned long)(time / 200ULL) | 0x01;
+	for (byte i = 0; i < 4; i++)
+		registers[REGISTER_SYS_CLOCK_0 + i] = sysClock >> (8 * i);
+
+	memcpy(&registers[REGISTER_STATE_DATA_0], ALGO_STATE, sizeof(ALGO_STATE));
+	registers[REGISTER_STATE_DATA_10_TJ] = SIMULATOR_TEMPERATURE;
+
+	unsigned long referenceHits = 50000UL + registers[REGISTER_RESULT_NUMBER];
+	unsigned long objectHits = reliability * 1000UL + registers[REGISTER_RESULT_NUMBER];
+	for (byte i = 0; i < 4; i++)
+	{
+		registers[REGISTER_REFERENCE_HITS_0 + i] = referenceHits >> (8 * i);
+		registers[REGISTER_OBJECT_HITS_0 + i] = objectHits >> (8 * i);
+	}
+
+	registers[REGISTER_INT_STATUS] |= INTERRUPT_MASK;
+	measurementCount++;
+	activeTime += rangingTime;
+}
+
+void SimulatedTMF8801::startRanging()
+{
+	// Iteration counts the library can't have meant fall back to the default
+	unsigned int kiloIterations = registers[REGISTER_CMD_DATA0];
+	kiloIterations = (kiloIterations << 8) | registers[REGISTER_CMD_DATA1];
+	if (kiloIterations < 10 || kiloIterations > 4000)
+		kiloIterations = SIMULATOR_DEFAULT_ITERATIONS;
+
+	// Ranging time scales with iterations. Results can't come faster than one ranging time apart.
+	rangingTime = SIMULATOR_RANGING_TIME * kiloIterations / SIMULATOR_DEFAULT_ITERATIONS;
+	resultInterval = registers[REGISTER_CMD_DATA2] * 1000000ULL;
+	if (resultInterval != 0 && resultInterval < rangingTime)
+		resultInterval = rangingTime;
+
+	nextResultTime = simulatorTime() + rangingTime;
+	ranging = true;
+}
+
+void SimulatedTMF8801::executeCommand(byte command)
+{
+	registers[REGISTER_PREVIOUS] = command;
+	registers[REGISTER_COMMAND] = 0;
+
+	switch (command)
+	{
+	case COMMAND_MEASURE:
+		startRanging();
+		break;
+
+	case COMMAND_STOP:
+		ranging = false;
+		break;
+
+	case COMMAND_FACTORY_CALIBRATION:
+		ranging = false;
+		registers[REGISTER_REGISTER_CONTENTS] = CONTENT_CALIBRATION;
+		registers[REGISTER_TID]++;
+		memcpy(&registers[REGISTER_FACTORY_CALIB_0], SIMULATOR_CALIBRATION, sizeof(SIMULATOR_CALIBRATION));
+		break;
+
+	case COMMAND_SERIAL:
+		ranging = false;
+		registers[REGISTER_REGISTER_CONTENTS] = COMMAND_SERIAL;
+		registers[REGISTER_TID]++;
+		registers[REGISTER_STATE_DATA_0] = SIMULATOR_SERIAL_NUMBER & 0xff;
+		registers[REGISTER_STATE_DATA_1] = SIMULATOR_SERIAL_NUMBER >> 8;
+		break;
+
+	// Calibration data load and GPIO commands have no visible effect on the registers
+	default:
+		break;
+	}
+}
+
+void SimulatedTMF8801::executeFrame(const byte* frame, unsigned int length)
+{
+	// Frames are command, data size, data and the inverted sum of all of them
+	byte sum = 0;
+	for (unsigned int i = 0; i + 1 < length; i++)
+		sum += frame[i];
+	if (length < 3 || frame[1] + 3U != length || (byte)~sum != frame[length - 1])
+	{
+		registers[REGISTER_BL_CMD_STAT] = 0xFF;
+		return;
+	}
+
+	registers[REGISTER_BL_CMD_STAT] = BL_STATUS_READY;
+
+	// The patch itself isn't executed, remapping RAM starts the measurement application
+	if (frame[0] == BL_COMMAND_RAMREMAP_RESET)
+	{
+		applicationRunning = true;
+		registers[REGISTER_APPID] = APPLICATION;
+		registers[REGISTER_APPREV_MAJOR] = SIMULATOR_APP_MAJOR;
+		registers[REGISTER_APPREV_MINOR] = SIMULATOR_APP_MINOR;
+	}
+}
+
+void SimulatedTMF8801::receive(const byte* data, unsigned int length)
+{
+	update();
+
+	// An address-only transaction just probes for the device
+	if (length == 0)
+		return;
+
+	registerPointer = data[0];
+	data++;
+	length--;
+	if (length == 0)
+		return;
+
+	if (!applicationRunning && registerPointer == REGISTER_BL_CMD_STAT)
+	{
+		executeFrame(data, length);
+		return;
+	}
+
+	bool command = false;
+	for (unsigned int i = 0; i < length; i++, registerPointer++)
+	{
+		byte value = data[i];
+		switch (registerPointer)
+		{
+		case REGISTER_ENABLE_REG:
+			if (value & (1 << CPU_RESET))
+				reset();
+			else
+				registers[REGISTER_ENABLE_REG] = (value & 0x01) ? 0x41 : 0x00;
+			break;
+
+		case REGISTER_INT_STATUS:
+			registers[REGISTER_INT_STATUS] &= ~value;
+			break;
+
+		case REGISTER_APPREQID:
+			if (value == APPLICATION && !applicationRunning)
+			{
+				applicationRunning = true;
+				registers[REGISTER_APPID] = APPLICATION;
+				registers[REGISTER_APPREV_MAJOR] = SIMULATOR_APP_MAJOR;
+				registers[REGISTER_APPREV_MINOR] = SIMULATOR_APP_MINOR;
+				registers[REGISTER_REGISTER_CONTENTS] = 0;
+			}
+			else if (value == BOOTLOADER && applicationRunning)
+			{
+				reset();
+			}
+			break;
+
+		// Read-only registers
+		case REGISTER_APPID:
+		case REGISTER_REGISTER_CONTENTS:
+		case REGISTER_TID:
+		case REGISTER_ID:
+		case REGISTER_REVID:
+			break;
+
+		case REGISTER_COMMAND:
+			registers[REGISTER_COMMAND] = value;
+			command = applicationRunning;
+			break;
+
+		default:
+			registers[registerPointer] = value;
+			break;
+		}
+	}
+
+	// Commands run once the whole burst, including CMD_DATA registers before it, is written
+	if (command)
+		executeCommand(registers[REGISTER_COMMAND]);
+}
+
+void SimulatedTMF8801::transmit(byte* data, unsigned int length)
+{
+	update();
+	for (unsigned int i = 0; i < length; i++)
+		data[i] = registers[registerPointer++];
+}
@@ -0,0 +1,96 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file models the TMF8801 register map so examples can run on a host without hardware.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_SIMULATOR_DEVICE__
+#define __TMF8801_SIMULATOR_DEVICE__
+
+#include "Arduino.h"
+
+// Returns the distance in millimeters and the reliability (0 to 63) of a result completed at time milliseconds
+typedef void (*SimulatorScene)(unsigned long time, unsigned int& distance, byte& reliability);
+
+// Register level model of a TMF8801. It covers the bootloader (frame checksums and RAM remap),
+// loading the measurement application and the commands used by the library: measure, stop,
+// factory calibration, serial number and GPIO. Results are produced on simulated time, so a
+// sketch sees the same sequence of results on every run.
+class SimulatedTMF8801
+{
+private:
+	byte address;
+	byte registers[256];
+
+	// Scene reported by new results
+	SimulatorScene scene = NULL;
+
+	// True while the measurement application is running
+	bool applicationRunning;
+
+	// Ranging state. Times are simulated nanoseconds.
+	bool ranging;
+	unsigned long long nextResultTime;
+	unsigned long long resultInterval;
+	unsigned long long rangingTime;
+
+	// Register pointer set by the last write transaction
+	byte registerPointer = 0;
+
+	// Results produced and time spent ranging since power on
+	unsigned long measurementCount = 0;
+	unsigned long long activeTime = 0;
+
+	// Restarts the CPU into the bootloader
+	void reset();
+
+	// Produces every result due by now
+	void update();
+
+	// Fills the result registers with a new result completed at time
+	void produceResult(unsigned long long time);
+
+	// Executes a command written to REGISTER_COMMAND by the application
+	void executeCommand(byte command);
+
+	// Executes a frame written to the bootloader command register
+	void executeFrame(const byte* frame, unsigned int length);
+
+	// Starts ranging with CMD_DATA_2 as repetition period and CMD_DATA_1/0 as iterations in thousands
+	void startRanging();
+
+public:
+	SimulatedTMF8801(byte address = 0x41);
+
+	// Sets the scene used by results from now on. Without a scene every result is 250 mm with reliability 63.
+	void setScene(SimulatorScene newScene);
+
+	// I2C address the device answers to
+	byte getAddress();
+
+	// Handles a write transaction. The first byte sets the register pointer, the rest are written from there.
+	void receive(const byte* data, unsigned int length);
+
+	// Handles a read transaction starting at the register pointer
+	void transmit(byte* data, unsigned int length);
+
+	// Returns the number of results produced since power on
+	unsigned long getMeasurementCount();
+
+	// Returns the time spent ranging since power on in microseconds
+	unsigned long getActiveTime();
+};
+
+#endif
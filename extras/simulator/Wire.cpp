@@ -0,0 +1,121 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file provides a host-side I2C bus with simulated devices attached to it.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Wire.h"
+#include "SimulatedTMF8801.h"
+
+TwoWire Wire;
+TwoWire Wire1;
+
+void TwoWire::attach(SimulatedTMF8801& device)
+{
+	if (deviceCount < SIMULATOR_MAX_DEVICES)
+		devices[deviceCount++] = &device;
+}
+
+SimulatedTMF8801* TwoWire::findDevice(byte address)
+{
+	for (byte i = 0; i < deviceCount; i++)
+		if (devices[i]->getAddress() == address)
+			return devices[i];
+	return NULL;
+}
+
+void TwoWire::clockTransaction(unsigned int bytes)
+{
+	// Address byte plus data bytes take 9 clocks each, START and STOP roughly one clock each
+	unsigned long long clocks = (bytes + 1) * 9ULL + 2;
+	simulatorAdvance(clocks * 1000000000ULL / SIMULATOR_BUS_CLOCK);
+}
+
+void TwoWire::begin()
+{
+}
+
+void TwoWire::setClock(unsigned long)
+{
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+	transmitAddress = address;
+	transmitLength = 0;
+}
+
+size_t TwoWire::write(uint8_t value)
+{
+	if (transmitLength >= sizeof(transmitBuffer))
+		return 0;
+	transmitBuffer[transmitLength++] = value;
+	return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool)
+{
+	SimulatedTMF8801* device = findDevice(transmitAddress);
+
+	// A missing device doesn't acknowledge its address
+	if (device == NULL)
+	{
+		clockTransaction(0);
+		return 2;
+	}
+
+	clockTransaction(transmitLength);
+	device->receive(transmitBuffer, transmitLength);
+	return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity)
+{
+	receiveLength = 0;
+	receivePosition = 0;
+
+	SimulatedTMF8801* device = findDevice(address);
+	if (device == NULL)
+	{
+		clockTransaction(0);
+		return 0;
+	}
+
+	// Like the AVR core, reads longer than the buffer are cut short
+	if (quantity > BUFFER_LENGTH)
+		quantity = BUFFER_LENGTH;
+
+	clockTransaction(quantity);
+	device->transmit(receiveBuffer, quantity);
+	receiveLength = quantity;
+	return quantity;
+}
+
+uint8_t TwoWire::requestFrom(int address, int quantity)
+{
+	return requestFrom((uint8_t)address, (uint8_t)quantity);
+}
+
+int TwoWire::available()
+{
+	return receiveLength - receivePosition;
+}
+
+int TwoWire::read()
+{
+	if (receivePosition >= receiveLength)
+		return -1;
+	return receiveBuffer[receivePosition++];
+}
@@ -0,0 +1,78 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file provides a host-side I2C bus with simulated devices attached to it.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_SIMULATOR_WIRE__
+#define __TMF8801_SIMULATOR_WIRE__
+
+#include "Arduino.h"
+
+// Same receive buffer size as the AVR core
+#define BUFFER_LENGTH 32
+
+// Maximum number of devices attached to one bus
+const byte SIMULATOR_MAX_DEVICES = 8;
+
+// Bus clock used to advance simulated time with every transaction
+const unsigned long SIMULATOR_BUS_CLOCK = 400000;
+
+class SimulatedTMF8801;
+
+class TwoWire
+{
+private:
+	// Attached devices
+	SimulatedTMF8801* devices[SIMULATOR_MAX_DEVICES];
+	byte deviceCount = 0;
+
+	// Pending write transaction
+	byte transmitAddress;
+	byte transmitBuffer[256];
+	unsigned int transmitLength = 0;
+
+	// Bytes received by the last requestFrom() call
+	byte receiveBuffer[BUFFER_LENGTH];
+	byte receiveLength = 0;
+	byte receivePosition = 0;
+
+	// Returns the device answering address, or NULL if there is none
+	SimulatedTMF8801* findDevice(byte address);
+
+	// Advances simulated time by the wire time of a transaction carrying bytes after the address byte
+	void clockTransaction(unsigned int bytes);
+
+public:
+	// Attaches a simulated device to the bus. Call it before the sketch's setup().
+	void attach(SimulatedTMF8801& device);
+
+	void begin();
+	void setClock(unsigned long clockSpeed);
+
+	void beginTransmission(uint8_t address);
+	size_t write(uint8_t value);
+	uint8_t endTransmission(bool sendStop = true);
+
+	uint8_t requestFrom(uint8_t address, uint8_t quantity);
+	uint8_t requestFrom(int address, int quantity);
+	int available();
+	int read();
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+#endif
@@ -0,0 +1,155 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file adapts TMF-8801 measurement rate and iterations to scene dynamics.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SparkFun_TMF8801_AdaptiveSampler.h"
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+void TMF8801_AdaptiveSampler::setPeriodBounds(byte minimum, byte maximum)
+{
+	minimumPeriod = minimum;
+	maximumPeriod = maximum;
+}
+
+void TMF8801_AdaptiveSampler::setIterationBounds(unsigned int minimum, unsigned int maximum)
+{
+	minimumIterations = minimum;
+	maximumIterations = maximum;
+}
+
+void TMF8801_AdaptiveSampler::setVelocityThreshold(unsigned int millimetersPerSecond)
+{
+	velocityThreshold = millimetersPerSecond;
+}
+
+void TMF8801_AdaptiveSampler::setTargetReliability(byte reliability)
+{
+	targetReliability = reliability;
+}
+
+void TMF8801_AdaptiveSampler::setBackoffSamples(byte samples)
+{
+	backoffSamples = samples;
+}
+
+bool TMF8801_AdaptiveSampler::update(TMF8801& sensor)
+{
+	// Repeated calls between two results must not count as still samples
+	if (!sensor.readNewMeasurement())
+		return false;
+
+	int distance = sensor.getLastDistance();
+	byte reliability = sensor.getMeasurementReliability();
+	unsigned long now = millis();
+	samples++;
+
+	// Start from the sensor's period, within bounds, and the most iterations allowed. The
+	// sensor's own iteration bytes are not used because its defaults don't decode to a count.
+	bool seeded = false;
+	if (!configured)
+	{
+		period = constrain(sensor.getRepetitionPeriod(), minimumPeriod, maximumPeriod);
+		iterations = maximumIterations;
+		configured = true;
+		seeded = true;
+	}
+
+	// Velocity is estimated between consecutive reliable results
+	bool reliable = reliability >= targetReliability;
+	bool moving = false;
+	if (reliable)
+	{
+		if (lastValid && now != lastTime)
+		{
+			unsigned long velocity = (unsigned long)abs(distance - lastDistance) * 1000UL / (now - lastTime);
+			moving = velocity >= velocityThreshold;
+		}
+		lastDistance = distance;
+		lastTime = now;
+		lastValid = true;
+	}
+
+	// Ramp up at once on motion, back off gradually while still
+	unsigned int newPeriod = period;
+	if (moving)
+	{
+		stillSamples = 0;
+		newPeriod = minimumPeriod;
+	}
+	else if (++stillSamples >= backoffSamples)
+	{
+		stillSamples = 0;
+		newPeriod = period * 2;
+	}
+
+	// A weak target gets more iterations. Reliability 0 means nothing is detected at all, which
+	// more iterations would not fix.
+	unsigned int newIterations = iterations;
+	if (reliability > 0 && !reliable)
+		newIterations = iterations + iterations / 2;
+	else if (!moving && reliability >= 2 * targetReliability)
+		newIterations = iterations - iterations / 4;
+
+	newPeriod = constrain(newPeriod, minimumPeriod, maximumPeriod);
+	newIterations = constrain(newIterations, minimumIterations, maximumIterations);
+
+	// Only touch the bus when something changed, or to apply the seeded settings
+	if (!seeded && newPeriod == period && newIterations == iterations)
+		return false;
+
+	period = newPeriod;
+	iterations = newIterations;
+	sensor.setMeasurementTiming(period, iterations);
+	adjustments++;
+	return true;
+}
+
+byte TMF8801_AdaptiveSampler::getRepetitionPeriod()
+{
+	return period;
+}
+
+unsigned int TMF8801_AdaptiveSampler::getIterations()
+{
+	return iterations;
+}
+
+float TMF8801_AdaptiveSampler::getDutyCycle()
+{
+	// Settings are unknown until the first result was processed
+	if (!configured)
+		return 0;
+
+	// A period of 0 runs a single measurement
+	if (period == 0)
+		return 1;
+
+	// Ranging time scales with the number of iterations
+	float rangingTime = (float)iterations * RANGING_TIME_900K / 900;
+	float dutyCycle = rangingTime / period;
+	return dutyCycle > 1 ? 1 : dutyCycle;
+}
+
+unsigned long TMF8801_AdaptiveSampler::getSamples()
+{
+	return samples;
+}
+
+unsigned long TMF8801_AdaptiveSampler::getAdjustments()
+{
+	return adjustments;
+}
@@ -0,0 +1,104 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file adapts TMF-8801 measurement rate and iterations to scene dynamics.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_LIBRARY_ADAPTIVE_SAMPLER__
+#define __TMF8801_LIBRARY_ADAPTIVE_SAMPLER__
+
+#include <Arduino.h>
+
+class TMF8801;
+
+// Ranging time of the default 900k iterations mode, from the TMF8801 datasheet
+const byte RANGING_TIME_900K = 33;
+
+// Retunes repetition period and iterations from the measured scene. The period drops to its
+// minimum as soon as the target moves and doubles after a number of still samples. Iterations
+// rise while a target is detected with low reliability and fall when reliability is ample.
+class TMF8801_AdaptiveSampler
+{
+private:
+	// Bounds
+	byte minimumPeriod = 33;
+	byte maximumPeriod = 250;
+	unsigned int minimumIterations = 300;
+	unsigned int maximumIterations = 900;
+
+	// Target speed in mm/s regarded as motion
+	unsigned int velocityThreshold = 100;
+
+	// Reliability below which more iterations are used. Twice this value allows fewer iterations.
+	byte targetReliability = 15;
+
+	// Consecutive still samples before the period is doubled
+	byte backoffSamples = 5;
+
+	// Current settings
+	byte period;
+	unsigned int iterations;
+	bool configured = false;
+
+	// Last reliable result and millis() when it was read
+	int lastDistance;
+	unsigned long lastTime;
+	bool lastValid = false;
+
+	byte stillSamples = 0;
+	unsigned long samples = 0;
+	unsigned long adjustments = 0;
+
+public:
+	// Default constructor
+	TMF8801_AdaptiveSampler() {}
+
+	// Sets shortest and longest repetition period in milliseconds
+	void setPeriodBounds(byte minimum, byte maximum);
+
+	// Sets lowest and highest number of iterations in thousands
+	void setIterationBounds(unsigned int minimum, unsigned int maximum);
+
+	// Sets target speed in mm/s above which the scene is considered moving
+	void setVelocityThreshold(unsigned int millimetersPerSecond);
+
+	// Sets reliability (0 - 63) the controller tries to keep
+	void setTargetReliability(byte reliability);
+
+	// Sets how many consecutive still samples are needed before the period is doubled
+	void setBackoffSamples(byte samples);
+
+	// Reads a new result, if one is available, and retunes the sensor if needed. Each result is
+	// processed once, however often this is called. Returns true if the timing was changed.
+	bool update(TMF8801& sensor);
+
+	// Returns current repetition period in milliseconds
+	byte getRepetitionPeriod();
+
+	// Returns current number of iterations in thousands
+	unsigned int getIterations();
+
+	// Returns estimated fraction of time (0 - 1) the sensor spends ranging with the current settings.
+	// Returns 0 until update() has processed the first result.
+	float getDutyCycle();
+
+	// Returns the number of results processed
+	unsigned long getSamples();
+
+	// Returns the number of timing changes written to the sensor
+	unsigned long getAdjustments();
+};
+
+#endif
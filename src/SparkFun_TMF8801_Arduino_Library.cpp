@@ -57,22 +57,34 @@ bool TMF8801::begin(byte address, TwoWire& wirePort)
 		return false;
 	}
 
-	// Set calibration data
+	// Set calibration data and start the application
+	configureApplication();
+
+	tmf8801_io.wait(10);
+
+	// Set lastError no NONE
+	lastError = ERROR_NONE;
+	return true;
+}
+
+void TMF8801::configureApplication()
+{
+	// A freshly loaded application starts from the default algorithm state
+	memcpy(algorithmState, ALGO_STATE, sizeof(algorithmState));
+	loadTransactionId = tmf8801_io.readSingleByte(REGISTER_TID);
+
+	// Write calibration data and algorithm state into device
 	tmf8801_io.writeSingleByte(REGISTER_COMMAND, COMMAND_CALIBRATION);
 	tmf8801_io.writeMultipleBytes(REGISTER_FACTORY_CALIB_0, calibrationData, sizeof(calibrationData));
-	tmf8801_io.writeMultipleBytes(REGISTER_STATE_DATA_WR_0, ALGO_STATE, sizeof(ALGO_STATE));
+	tmf8801_io.writeMultipleBytes(REGISTER_STATE_DATA_WR_0, algorithmState, sizeof(algorithmState));
 
 	// Configure the application - values were taken from AN0597, pp. 22
-	updateCommandData8();	
+	updateCommandData8();
 
-	// Start the application
+	// Start measurements application
 	tmf8801_io.writeSingleByte(REGISTER_COMMAND, COMMAND_MEASURE);
-
-	delay(10);
-
-	// Set lastError no NONE
-	lastError = ERROR_NONE;
-	return true;
+	continuousMode = true;
+	singleShotPending = false;
 }
 
 bool TMF8801::cpuReady()
@@ -86,7 +98,7 @@ bool TMF8801::cpuReady()
 		if (ready == false)
 		{
 			counter++;
-			delay(100);
+			tmf8801_io.wait(100);
 		}
 		else
 		{
@@ -127,7 +139,7 @@ bool TMF8801::applicationReady()
 		if (ready == false)
 		{
 			counter++;
-			delay(100);
+			tmf8801_io.wait(100);
 		}
 		else
 		{
@@ -147,7 +159,9 @@ byte TMF8801::getLastError()
 bool TMF8801::getCalibrationData(byte* calibrationResults)
 {
 	tmf8801_io.writeSingleByte(REGISTER_COMMAND, 0xff);
-	delay(50);
+	continuousMode = false;
+	singleShotPending = false;
+	tmf8801_io.wait(50);
 
 	// Returns device's calibration data values (14 bytes)
 	lastError = ERROR_NONE;
@@ -157,15 +171,15 @@ bool TMF8801::getCalibrationData(byte* calibrationResults)
 	do
 	{
 		tmf8801_io.writeSingleByte(REGISTER_COMMAND, COMMAND_FACTORY_CALIBRATION);
-		delay(10);
+		tmf8801_io.wait(10);
 		value = tmf8801_io.readSingleByte(REGISTER_REGISTER_CONTENTS);
 		if (value == CONTENT_CALIBRATION)
 		{
-			delay(10);
+			tmf8801_io.wait(10);
 			tmf8801_io.readMultipleBytes(REGISTER_FACTORY_CALIB_0, calibrationResults, CALIBRATION_DATA_LENGTH);
 			return true;
 		}
-		delay(50);
+		tmf8801_io.wait(50);
 	} while (millis() - calibrationStart < 30000);
 	
 	// returns false and writes the lastError if TMF8801 calibration data read operation fails
@@ -205,9 +219,9 @@ short TMF8801::getSerialNumber()
 	// Request serial number to device
 	do
 	{	tmf8801_io.writeSingleByte(REGISTER_COMMAND, COMMAND_SERIAL);
-		delay(50);
+		tmf8801_io.wait(50);
 		result = tmf8801_io.readSingleByte(REGISTER_REGISTER_CONTENTS);
-		delay(10);
+		tmf8801_io.wait(10);
 	} while (result != COMMAND_SERIAL);
 
 	// Read two bytes and combine them as a single int
@@ -255,19 +269,11 @@ void TMF8801::resetDevice()
 		ready = applicationReady();
 	} while (!ready);
 
-	// Write calibration data and algorithm state into device
-	tmf8801_io.writeSingleByte(REGISTER_COMMAND, COMMAND_CALIBRATION);
-	tmf8801_io.writeMultipleBytes(REGISTER_FACTORY_CALIB_0, calibrationData, sizeof(calibrationData));
-	tmf8801_io.writeMultipleBytes(REGISTER_STATE_DATA_WR_0, ALGO_STATE, sizeof(ALGO_STATE));
-
-	// Updates CMD_DATA_7 to CMD_DATA_0
-	updateCommandData8();
-
-	// Start measurements application
-	tmf8801_io.writeSingleByte(REGISTER_COMMAND, COMMAND_MEASURE);
+	// Write calibration data and algorithm state into device and start measurements
+	configureApplication();
 
 	// Wait 50 msec then return
-	delay(50);
+	tmf8801_io.wait(50);
 }
 
 void TMF8801::wakeUpDevice()
@@ -278,7 +284,7 @@ void TMF8801::wakeUpDevice()
 	{
 		tmf8801_io.writeSingleByte(REGISTER_ENABLE_REG, 0x01);
 		result = tmf8801_io.readSingleByte(REGISTER_ENABLE_REG);
-		delay(100);
+		tmf8801_io.wait(100);
 	} while (result != 0x41);
 }
 
@@ -289,13 +295,10 @@ byte TMF8801::getStatus()
 
 void TMF8801::doMeasurement()
 {
-	byte buffer[4];
-	tmf8801_io.readMultipleBytes(REGISTER_RESULT_NUMBER, buffer, sizeof(buffer));
-	resultNumber = buffer[0];
-	resultInfo = buffer[1];
-	distancePeak = buffer[3];
-	distancePeak = distancePeak << 8;
-	distancePeak += buffer[2];
+	// Transaction ID is read along with the result so readNewMeasurement() won't report it again
+	byte buffer[6];
+	tmf8801_io.readMultipleBytes(REGISTER_REGISTER_CONTENTS, buffer, sizeof(buffer));
+	latchResult(buffer);
 }
 
 int TMF8801::getDistance()
@@ -307,12 +310,17 @@ int TMF8801::getDistance()
 	return distancePeak;
 }
 
+int TMF8801::getLastDistance()
+{
+	return distancePeak;
+}
+
 void TMF8801::enableInterrupt()
 {
 	byte registerValue = tmf8801_io.readSingleByte(REGISTER_INT_ENAB);
 	registerValue |= INTERRUPT_MASK;
 	tmf8801_io.writeSingleByte(REGISTER_INT_ENAB, registerValue);
-	delay(10);
+	tmf8801_io.wait(10);
 	doMeasurement();
 }
 
@@ -350,10 +358,9 @@ void TMF8801::setGPIO0Mode(byte gpioMode)
 	if (gpioMode > MODE_HIGH_OUTPUT)
 		return;
 
-	byte currentRegisterValue;
-
-	// Read current value and change only GPIO0 values
-	currentRegisterValue = tmf8801_io.readSingleByte(REGISTER_CMD_DATA0);
+	// CMD_DATA0 is write-only, so the current settings are taken from CMD_DATA_5 which every
+	// measure command sends as well. Change only GPIO0 values.
+	byte currentRegisterValue = commandDataValues[CMD_DATA_5];
 	currentRegisterValue &= 0xf0;
 	currentRegisterValue += gpioMode;
 	commandDataValues[CMD_DATA_5] = currentRegisterValue;
@@ -367,10 +374,8 @@ void TMF8801::setGPIO0Mode(byte gpioMode)
 
 byte TMF8801::getGPIO0Mode()
 {
-	// Read REGISTER_CMD_DATA0 and mask accordingly
-	byte currentRegisterValue;
-	currentRegisterValue = tmf8801_io.readSingleByte(REGISTER_CMD_DATA0);
-	return (currentRegisterValue & 0x0f);
+	// Mask the GPIO settings last sent to the device
+	return (commandDataValues[CMD_DATA_5] & 0x0f);
 }
 
 void TMF8801::setGPIO1Mode(byte gpioMode)
@@ -379,10 +384,9 @@ void TMF8801::setGPIO1Mode(byte gpioMode)
 	if (gpioMode > MODE_HIGH_OUTPUT)
 		return;
 
-	byte currentRegisterValue;
-
-	// Read current value and change only GPIO1 values
-	currentRegisterValue = tmf8801_io.readSingleByte(REGISTER_CMD_DATA0);
+	// CMD_DATA0 is write-only, so the current settings are taken from CMD_DATA_5 which every
+	// measure command sends as well. Change only GPIO1 values.
+	byte currentRegisterValue = commandDataValues[CMD_DATA_5];
 	currentRegisterValue &= 0x0f;
 	currentRegisterValue += (gpioMode << 4);
 	commandDataValues[CMD_DATA_5] = currentRegisterValue;
@@ -396,10 +400,8 @@ void TMF8801::setGPIO1Mode(byte gpioMode)
 
 byte TMF8801::getGPIO1Mode()
 {
-	// Read REGISTER_CMD_DATA0 and shift accordingly
-	byte currentRegisterValue;
-	currentRegisterValue = tmf8801_io.readSingleByte(REGISTER_CMD_DATA0);
-	return (currentRegisterValue >> 4);
+	// Shift the GPIO settings last sent to the device
+	return (commandDataValues[CMD_DATA_5] >> 4);
 }
 
 byte TMF8801::getRegisterValue(byte reg)
@@ -421,3 +423,256 @@ void TMF8801::setRegisterMultipleValues(byte reg, const byte* buffer, byte lengt
 {
 	tmf8801_io.writeMultipleBytes(reg, buffer, length);
 }
+
+void TMF8801::startMeasurement(byte repetitionPeriod)
+{
+	// Read REGISTER_CONTENTS through STATE_DATA_10 in a single transaction
+	byte state[REGISTER_STATE_DATA_10_TJ - REGISTER_REGISTER_CONTENTS + 1];
+	tmf8801_io.readMultipleBytes(REGISTER_REGISTER_CONTENTS, state, sizeof(state));
+
+	// Keep the algorithm state of the last result, unless the registers still hold what was written here
+	if (state[0] == COMMAND_RESULT && state[1] != loadTransactionId)
+		memcpy(algorithmState, &state[REGISTER_STATE_DATA_0 - REGISTER_REGISTER_CONTENTS], sizeof(algorithmState));
+
+	// Whatever result is there now is older than this measurement
+	loadTransactionId = state[1];
+	resultTransactionId = state[1];
+	resultRead = true;
+
+	// Registers from 0x20 hold results while ranging, so calibration data and algorithm state
+	// must be written again for CMD_DATA_7 = 0x03 to load them with the measure command
+	byte calibration[CALIBRATION_DATA_LENGTH + sizeof(algorithmState)];
+	memcpy(calibration, calibrationData, CALIBRATION_DATA_LENGTH);
+	memcpy(calibration + CALIBRATION_DATA_LENGTH, algorithmState, sizeof(algorithmState));
+	tmf8801_io.writeMultipleBytes(REGISTER_FACTORY_CALIB_0, calibration, sizeof(calibration));
+
+	// CMD_DATA_7 to CMD_DATA_0 are followed by REGISTER_COMMAND, so the configuration
+	// and the measure command can be sent in one burst
+	byte buffer[sizeof(commandDataValues) + 1];
+	memcpy(buffer, commandDataValues, sizeof(commandDataValues));
+	buffer[CMD_DATA_2] = repetitionPeriod;
+	buffer[sizeof(commandDataValues)] = COMMAND_MEASURE;
+	tmf8801_io.writeMultipleBytes(REGISTER_CMD_DATA7, buffer, sizeof(buffer));
+}
+
+void TMF8801::latchResult(const byte* buffer)
+{
+	resultTransactionId = buffer[1];
+	resultRead = true;
+	resultNumber = buffer[2];
+	resultInfo = buffer[3];
+	distancePeak = buffer[5];
+	distancePeak = distancePeak << 8;
+	distancePeak += buffer[4];
+}
+
+bool TMF8801::readNewMeasurement()
+{
+	// Read REGISTER_CONTENTS through DISTANCE_PEAK_1 in a single transaction
+	byte buffer[6];
+	tmf8801_io.readMultipleBytes(REGISTER_REGISTER_CONTENTS, buffer, sizeof(buffer));
+	if (buffer[0] != COMMAND_RESULT || (resultRead && buffer[1] == resultTransactionId))
+		return false;
+
+	latchResult(buffer);
+	return true;
+}
+
+void TMF8801::trigger()
+{
+	// Continuous ranging or a pending single shot must be stopped before a new measure
+	// command is accepted, otherwise poll() would report the old result
+	if (continuousMode || singleShotPending)
+		stopMeasurement();
+
+	// A repetition period of zero requests a single measurement
+	startMeasurement(0);
+	triggerTime = micros();
+	singleShotPending = true;
+}
+
+bool TMF8801::poll()
+{
+	if (!singleShotPending)
+		return false;
+
+	if (!readNewMeasurement())
+		return false;
+
+	singleShotLatency = micros() - triggerTime;
+	singleShotPending = false;
+
+	// Returns interrupt pin to open drain
+	clearInterruptFlag();
+	return true;
+}
+
+unsigned long TMF8801::getSingleShotLatency()
+{
+	return singleShotLatency;
+}
+
+void TMF8801::stopMeasurement()
+{
+	tmf8801_io.writeSingleByte(REGISTER_COMMAND, COMMAND_STOP);
+	tmf8801_io.wait(10);
+	continuousMode = false;
+	singleShotPending = false;
+}
+
+void TMF8801::setMeasurementTiming(byte repetitionPeriod, unsigned int kiloIterations)
+{
+	// CMD_DATA_1 holds the low byte and CMD_DATA_0 the high byte of the iteration count, as in
+	// the datasheet's register description
+	commandDataValues[CMD_DATA_2] = repetitionPeriod;
+	commandDataValues[CMD_DATA_1] = kiloIterations & 0xff;
+	commandDataValues[CMD_DATA_0] = kiloIterations >> 8;
+
+	// A running measurement only picks up new values with a new measure command
+	if (continuousMode)
+	{
+		stopMeasurement();
+		startContinuousMeasurement();
+	}
+}
+
+byte TMF8801::getRepetitionPeriod()
+{
+	return commandDataValues[CMD_DATA_2];
+}
+
+unsigned int TMF8801::getIterations()
+{
+	unsigned int iterations = commandDataValues[CMD_DATA_0];
+	iterations = iterations << 8;
+	iterations |= commandDataValues[CMD_DATA_1];
+	return iterations;
+}
+
+void TMF8801::startContinuousMeasurement()
+{
+	startMeasurement(commandDataValues[CMD_DATA_2]);
+	continuousMode = true;
+	singleShotPending = false;
+}
+
+// Combines four little endian bytes into a single value
+static unsigned long readLong(const byte* buffer)
+{
+	unsigned long value = buffer[3];
+	value = (value << 8) | buffer[2];
+	value = (value << 8) | buffer[1];
+	value = (value << 8) | buffer[0];
+	return value;
+}
+
+// Stores value as four little endian bytes
+static void writeLong(byte* buffer, unsigned long value)
+{
+	buffer[0] = value;
+	buffer[1] = value >> 8;
+	buffer[2] = value >> 16;
+	buffer[3] = value >> 24;
+}
+
+void TMF8801::getSnapshot(TMF8801_Snapshot& snapshot)
+{
+	byte app[SNAPSHOT_APP_LENGTH];
+	byte system[SNAPSHOT_SYSTEM_LENGTH];
+
+	// The application block is split only if it doesn't fit in the I2C buffer. offset is wider
+	// than a byte so buffers of 256 bytes or more can't make it wrap around.
+	for (unsigned int offset = 0; offset < SNAPSHOT_APP_LENGTH; offset += TMF8801_I2C_BUFFER_LENGTH)
+	{
+		byte length = SNAPSHOT_APP_LENGTH - offset;
+		if (length > TMF8801_I2C_BUFFER_LENGTH)
+			length = TMF8801_I2C_BUFFER_LENGTH;
+		tmf8801_io.readMultipleBytes(REGISTER_APPID + offset, app + offset, length);
+	}
+	tmf8801_io.readMultipleBytes(REGISTER_ENABLE_REG, system, SNAPSHOT_SYSTEM_LENGTH);
+
+	snapshot.timestamp = millis();
+	snapshot.appId = app[REGISTER_APPID];
+	snapshot.appVersionMajor = app[REGISTER_APPREV_MAJOR];
+	snapshot.appVersionMinor = app[REGISTER_APPREV_MINOR];
+	snapshot.appVersionPatch = app[REGISTER_APPREV_PATCH];
+	snapshot.status = app[REGISTER_STATUS];
+	snapshot.registerContents = app[REGISTER_REGISTER_CONTENTS];
+	snapshot.transactionId = app[REGISTER_TID];
+	snapshot.resultNumber = app[REGISTER_RESULT_NUMBER];
+	snapshot.resultInfo = app[REGISTER_RESULT_INFO];
+	snapshot.distance = app[REGISTER_DISTANCE_PEAK_1];
+	snapshot.distance = (snapshot.distance << 8) | app[REGISTER_DISTANCE_PEAK_0];
+	snapshot.sysClock = readLong(&app[REGISTER_SYS_CLOCK_0]);
+	memcpy(snapshot.stateData, &app[REGISTER_STATE_DATA_0], sizeof(snapshot.stateData));
+	snapshot.referenceHits = readLong(&app[REGISTER_REFERENCE_HITS_0]);
+	snapshot.objectHits = readLong(&app[REGISTER_OBJECT_HITS_0]);
+	snapshot.enable = system[REGISTER_ENABLE_REG - REGISTER_ENABLE_REG];
+	snapshot.interruptStatus = system[REGISTER_INT_STATUS - REGISTER_ENABLE_REG];
+	snapshot.interruptEnable = system[REGISTER_INT_ENAB - REGISTER_ENABLE_REG];
+	snapshot.chipId = system[REGISTER_ID - REGISTER_ENABLE_REG];
+	snapshot.revisionId = system[REGISTER_REVID - REGISTER_ENABLE_REG];
+}
+
+byte TMF8801::serializeSnapshot(const TMF8801_Snapshot& snapshot, byte* buffer)
+{
+	byte* position = buffer;
+	*position++ = SNAPSHOT_FORMAT_VERSION;
+	writeLong(position, snapshot.timestamp);
+	position += 4;
+	*position++ = snapshot.appId;
+	*position++ = snapshot.appVersionMajor;
+	*position++ = snapshot.appVersionMinor;
+	*position++ = snapshot.appVersionPatch;
+	*position++ = snapshot.status;
+	*position++ = snapshot.registerContents;
+	*position++ = snapshot.transactionId;
+	*position++ = snapshot.resultNumber;
+	*position++ = snapshot.resultInfo;
+	*position++ = snapshot.distance & 0xff;
+	*position++ = snapshot.distance >> 8;
+	writeLong(position, snapshot.sysClock);
+	position += 4;
+	memcpy(position, snapshot.stateData, sizeof(snapshot.stateData));
+	position += sizeof(snapshot.stateData);
+	writeLong(position, snapshot.referenceHits);
+	position += 4;
+	writeLong(position, snapshot.objectHits);
+	position += 4;
+	*position++ = snapshot.enable;
+	*position++ = snapshot.interruptStatus;
+	*position++ = snapshot.interruptEnable;
+	*position++ = snapshot.chipId;
+	*position++ = snapshot.revisionId;
+	return position - buffer;
+}
+
+void TMF8801::setBusArbiter(TMF8801_BusArbiter* arbiter)
+{
+	tmf8801_io.setBusArbiter(arbiter);
+}
+
+TMF8801_BusStatistics TMF8801::getBusStatistics()
+{
+	return tmf8801_io.getStatistics();
+}
+
+void TMF8801::resetBusStatistics()
+{
+	tmf8801_io.resetStatistics();
+}
+
+unsigned long TMF8801::getBusTime(unsigned long clockSpeed)
+{
+	// Every byte takes 9 clocks (8 data bits plus ACK). Each transaction adds its address
+	// byte plus roughly one clock each for START and STOP conditions.
+	TMF8801_BusStatistics statistics = tmf8801_io.getStatistics();
+	unsigned long bytes = statistics.transactions + statistics.bytesWritten + statistics.bytesRead;
+	unsigned long clocks = bytes * 9 + statistics.transactions * 2;
+
+	if (clockSpeed == 0)
+		return 0;
+
+	// Returns time in microseconds. 64-bit math keeps long-running statistics from overflowing.
+	return (unsigned long)(((unsigned long long)clocks * 1000000ULL) / clockSpeed);
+}
\ No newline at end of file
@@ -23,6 +23,12 @@
 #include <Wire.h>
 #include "SparkFun_TMF8801_Constants.h"
 #include "SparkFun_TMF8801_IO.h"
+#include "SparkFun_TMF8801_Zone.h"
+#include "SparkFun_TMF8801_Statistics.h"
+#include "SparkFun_TMF8801_SampleBuffer.h"
+#include "SparkFun_TMF8801_Scheduler.h"
+#include "SparkFun_TMF8801_PatchLoader.h"
+#include "SparkFun_TMF8801_AdaptiveSampler.h"
 
 #if (ARDUINO >= 100)
 #include "Arduino.h"
@@ -30,8 +36,51 @@
 #include "WProgram.h"
 #endif
 
+// Decoded copy of the application and system register blocks
+struct TMF8801_Snapshot
+{
+	// millis() when the snapshot was taken
+	unsigned long timestamp;
+
+	// Running application and its version
+	byte appId;
+	byte appVersionMajor;
+	byte appVersionMinor;
+	byte appVersionPatch;
+
+	// Application status, register contents and transaction ID
+	byte status;
+	byte registerContents;
+	byte transactionId;
+
+	// Last result
+	byte resultNumber;
+	byte resultInfo;
+	unsigned int distance;
+
+	// System clock of the last result
+	unsigned long sysClock;
+
+	// STATE_DATA_0 to STATE_DATA_10
+	byte stateData[11];
+
+	// Reference and object SPAD hit counters
+	unsigned long referenceHits;
+	unsigned long objectHits;
+
+	// ENABLE, INT_STATUS, INT_ENAB, ID and REVID registers
+	byte enable;
+	byte interruptStatus;
+	byte interruptEnable;
+	byte chipId;
+	byte revisionId;
+};
+
 class TMF8801
 {
+	// Uses the bootloader and reconfigures the application once a patch is running
+	friend class TMF8801_PatchLoader;
+
 private:
 	// CMD_DATA_7 to CMD_DATA_0 values used by updateCommandData8 function
 	// CMD_DATA_7 is commandDataValues[0], CMD_DATA_6 is commandDataValues[1] and so forth...
@@ -55,6 +104,30 @@ private:
 	// Holds last error generated by a function call
 	byte lastError;	
 
+	// True while a measurement started by trigger() has not been read yet
+	bool singleShotPending = false;
+
+	// True while the device is ranging continuously
+	bool continuousMode = false;
+
+	// Algorithm state written with the calibration data before every measure command. Refreshed
+	// from STATE_DATA_0 to STATE_DATA_10 whenever the device has produced a result since.
+	byte algorithmState[11];
+
+	// Transaction ID when calibration data and algorithm state were last written
+	byte loadTransactionId;
+
+	// Transaction ID of the last result read. The device changes it with every result, while
+	// writes from the host leave it untouched, so it detects new results even after 0x20 is reused.
+	byte resultTransactionId;
+	bool resultRead = false;
+
+	// micros() timestamp of the last trigger() call
+	unsigned long triggerTime;
+
+	// Trigger-to-result latency of the last single-shot measurement in microseconds
+	unsigned long singleShotLatency = 0;
+
 	// Polls if TMF8801's CPU is ready
 	bool cpuReady();
 
@@ -67,6 +140,17 @@ private:
 	// Updates registers CMD_DATA_7 to CMD_DATA_0 with commandDataValues array
 	void updateCommandData8();
 
+	// Writes calibration data, algorithm state and CMD_DATA registers, then starts measuring
+	void configureApplication();
+
+	// Reloads calibration data and algorithm state, then writes CMD_DATA_7 to CMD_DATA_0 and
+	// COMMAND_MEASURE in a single transaction
+	void startMeasurement(byte repetitionPeriod);
+
+	// Updates the measurement from a buffer read starting at REGISTER_CONTENTS
+	void latchResult(const byte* buffer);
+
+
 public:
 	// Default GPIO1 mode. You can find allowed values in SparkFun_TMF8801_Constants.h
 	byte gpio1_prog = MODE_LOW_OUTPUT;
@@ -98,6 +182,13 @@ public:
 	// Returns distance in mm
 	int getDistance();	
 
+	// Returns distance in mm of the last result read, without accessing the bus
+	int getLastDistance();
+
+	// Reads the result registers in one transaction. Returns true if they hold a result that was not
+	// read before, which is then available from getLastDistance() and getMeasurementReliability().
+	bool readNewMeasurement();
+
 	// Enable interrupt generation on each measurement
 	void enableInterrupt();
 
@@ -166,6 +257,54 @@ public:
 
 	// Wakes device up after ENABLE pin is brought back to HIGH
 	void wakeUpDevice();
+
+	// Stops continuous ranging or a pending single shot and starts a single measurement. Use poll()
+	// to check when it's done.
+	void trigger();
+
+	// Returns true once the measurement started by trigger() is ready. Read it with getLastDistance().
+	bool poll();
+
+	// Returns trigger-to-result latency of the last single-shot measurement in microseconds
+	unsigned long getSingleShotLatency();
+
+	// Restarts continuous ranging after single-shot measurements
+	void startContinuousMeasurement();
+
+	// Stops continuous ranging or a pending single-shot measurement
+	void stopMeasurement();
+
+	// Sets repetition period in milliseconds and number of iterations in thousands. Continuous
+	// ranging is restarted with the new values if it is running.
+	void setMeasurementTiming(byte repetitionPeriod, unsigned int kiloIterations);
+
+	// Returns configured repetition period in milliseconds
+	byte getRepetitionPeriod();
+
+	// Returns configured number of iterations in thousands. Only meaningful after setMeasurementTiming(),
+	// since the AN0597 defaults written by begin() don't decode to a documented iteration count.
+	unsigned int getIterations();
+
+	// Captures all application and system registers using as few burst reads as the I2C buffer allows.
+	// Measurements keep running, so when the block has to be split (I2C buffers under 59 bytes) a result
+	// arriving between reads can leave fields from two different result numbers in one snapshot.
+	void getSnapshot(TMF8801_Snapshot& snapshot);
+
+	// Packs snapshot into SNAPSHOT_SERIALIZED_LENGTH bytes (little endian) and returns the length
+	byte serializeSnapshot(const TMF8801_Snapshot& snapshot, byte* buffer);
+
+	// Shares the bus with other TMF8801 instances driven from different threads. Every register
+	// transaction is performed while holding arbiter. Call it before begin(). Pass NULL to disable.
+	void setBusArbiter(TMF8801_BusArbiter* arbiter);
+
+	// Returns I2C transactions, bytes and delay time accumulated since the last reset
+	TMF8801_BusStatistics getBusStatistics();
+
+	// Clears accumulated bus statistics
+	void resetBusStatistics();
+
+	// Returns modelled wire time in microseconds of the accumulated bus traffic at clockSpeed Hz. Returns 0 if clockSpeed is 0.
+	unsigned long getBusTime(unsigned long clockSpeed);
 	
 };
 
@@ -47,6 +47,8 @@ const byte ERROR_CPU_RESET_TIMEOUT = 0x02;
 const byte ERROR_WRONG_CHIP_ID = 0x03;
 const byte ERROR_CPU_LOAD_APPLICATION_ERROR = 0x04;
 const byte ERROR_FACTORY_CALIBRATION_ERROR = 0x05;
+const byte ERROR_BOOTLOADER_ERROR = 0x06;
+const byte ERROR_PATCH_FORMAT_ERROR = 0x07;
 
 // GPIO mode
 const byte MODE_INPUT = 0x0;
@@ -56,6 +58,12 @@ const byte MODE_VCSEL = 0x03;
 const byte MODE_LOW_OUTPUT = 0x04;
 const byte MODE_HIGH_OUTPUT = 0x05;
 
+// Zone events
+const byte ZONE_EVENT_NONE = 0x0;
+const byte ZONE_EVENT_ENTER = 0x01;
+const byte ZONE_EVENT_EXIT = 0x02;
+const byte ZONE_EVENT_CHANGED = 0x03;
+
 // COMMAND constants
 const byte CMD_DATA_7 = 0x0;
 const byte CMD_DATA_6 = 0x01;
@@ -126,6 +134,23 @@ const byte REGISTER_INT_ENAB = 0xE2;
 const byte REGISTER_ID = 0xE3;
 const byte REGISTER_REVID = 0xE4;
 
+// Bootloader commands and status - see TMF8801 datasheet, bootloader section
+const byte REGISTER_BL_CMD_STAT = 0x08;
+const byte BL_COMMAND_RAMREMAP_RESET = 0x11;
+const byte BL_COMMAND_DOWNLOAD_INIT = 0x14;
+const byte BL_COMMAND_W_RAM = 0x41;
+const byte BL_COMMAND_ADDR_RAM = 0x43;
+const byte BL_DOWNLOAD_INIT_SEED = 0x29;
+const byte BL_STATUS_READY = 0x00;
+const byte BL_MAX_DATA_LENGTH = 128;
+const byte BL_READY_TIMEOUT = 100;
+
 // Calibration data
 const byte CALIBRATION_DATA_LENGTH = 14;
+
+// Register snapshot: application block 0x00 - 0x3A and system block 0xE0 - 0xE4
+const byte SNAPSHOT_APP_LENGTH = 0x3B;
+const byte SNAPSHOT_SYSTEM_LENGTH = 0x05;
+const byte SNAPSHOT_FORMAT_VERSION = 0x01;
+const byte SNAPSHOT_SERIALIZED_LENGTH = 44;
 #endif
\ No newline at end of file
@@ -28,24 +28,38 @@ bool TMF8801_IO::begin(byte address, TwoWire& wirePort)
 
 bool TMF8801_IO::isConnected()
 {
+	lockBus();
+	_statistics.transactions++;
 	_i2cPort->beginTransmission(_address);
-	if (_i2cPort->endTransmission() != 0)
+	byte result = _i2cPort->endTransmission();
+	unlockBus();
+
+	if (result != 0)
 		return (false);
 	return (true); 
 }
 
 void TMF8801_IO::writeMultipleBytes(byte registerAddress, const byte* buffer, byte const packetLength)
 {
+	lockBus();
+	_statistics.transactions++;
+	_statistics.bytesWritten += 1 + packetLength;
 	_i2cPort->beginTransmission(_address);
 	_i2cPort->write(registerAddress);
 	for (byte i = 0; i < packetLength; i++) 
 		_i2cPort->write(buffer[i]);
 	
 	_i2cPort->endTransmission();
+	unlockBus();
 }
 
 void TMF8801_IO::readMultipleBytes(byte registerAddress, byte* buffer, byte const packetLength)
 {
+	// Register pointer write and data read must not be split by another device's transaction
+	lockBus();
+	_statistics.transactions += 2;
+	_statistics.bytesWritten++;
+	_statistics.bytesRead += packetLength;
 	_i2cPort->beginTransmission(_address);
 	_i2cPort->write(registerAddress);
 	_i2cPort->endTransmission();
@@ -53,39 +67,55 @@ void TMF8801_IO::readMultipleBytes(byte registerAddress, byte* buffer, byte cons
 	_i2cPort->requestFrom(_address, packetLength);
 	for (byte i = 0; (i < packetLength) && _i2cPort->available(); i++)
 		buffer[i] = _i2cPort->read();
+	unlockBus();
 }
 
 byte TMF8801_IO::readSingleByte(byte registerAddress)
 {
 	byte result;
+	lockBus();
+	_statistics.transactions += 2;
+	_statistics.bytesWritten++;
+	_statistics.bytesRead++;
 	_i2cPort->beginTransmission(_address);
 	_i2cPort->write(registerAddress);
 	_i2cPort->endTransmission();
 	_i2cPort->requestFrom(_address, 1U);
 	result = _i2cPort->read();
+	unlockBus();
 	return result;
 }
 
 void TMF8801_IO::writeSingleByte(byte registerAddress, byte const value)
 {
+	lockBus();
+	_statistics.transactions++;
+	_statistics.bytesWritten += 2;
 	_i2cPort->beginTransmission(_address);
 	_i2cPort->write(registerAddress);
 	_i2cPort->write(value);
 	_i2cPort->endTransmission();
+	unlockBus();
 }
 
 void TMF8801_IO::setRegisterBit(byte registerAddress, byte const bitPosition)
 {
+	// Keep the read-modify-write sequence atomic
+	lockBus();
 	byte value = readSingleByte(registerAddress);
 	value |= (1 << bitPosition);
 	writeSingleByte(registerAddress, value);
+	unlockBus();
 }
 
 void TMF8801_IO::clearRegisterBit(byte registerAddress, byte const bitPosition)
 {
+	// Keep the read-modify-write sequence atomic
+	lockBus();
 	byte value = readSingleByte(registerAddress);
 	value &= ~(1 << bitPosition);
 	writeSingleByte(registerAddress, value);
+	unlockBus();
 }
 
 bool TMF8801_IO::isBitSet(byte registerAddress, byte const bitPosition)
@@ -96,4 +126,52 @@ bool TMF8801_IO::isBitSet(byte registerAddress, byte const bitPosition)
 		return true;
 	else
 		return false;
+}
+
+void TMF8801_IO::wait(unsigned long milliseconds)
+{
+	_statistics.delayMillis += milliseconds;
+	delay(milliseconds);
+}
+
+TMF8801_BusStatistics TMF8801_IO::getStatistics()
+{
+	return _statistics;
+}
+
+void TMF8801_IO::resetStatistics()
+{
+	_statistics.transactions = 0;
+	_statistics.bytesWritten = 0;
+	_statistics.bytesRead = 0;
+	_statistics.delayMillis = 0;
+	_statistics.arbitrationWaitMicros = 0;
+	_statistics.arbitrationWaitMaxMicros = 0;
+}
+
+void TMF8801_IO::setBusArbiter(TMF8801_BusArbiter* arbiter)
+{
+	_arbiter = arbiter;
+}
+
+void TMF8801_IO::lockBus()
+{
+	if (_arbiter == NULL || _lockDepth++ > 0)
+		return;
+
+	unsigned long start = micros();
+	_arbiter->lock();
+	unsigned long waited = micros() - start;
+
+	_statistics.arbitrationWaitMicros += waited;
+	if (waited > _statistics.arbitrationWaitMaxMicros)
+		_statistics.arbitrationWaitMaxMicros = waited;
+}
+
+void TMF8801_IO::unlockBus()
+{
+	if (_arbiter == NULL || --_lockDepth > 0)
+		return;
+
+	_arbiter->unlock();
 }
\ No newline at end of file
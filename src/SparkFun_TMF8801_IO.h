@@ -23,12 +23,89 @@
 #include <Wire.h>
 #include "SparkFun_TMF8801_Constants.h"
 
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+// Largest number of bytes Wire can send or receive in one transaction
+#if defined(I2C_BUFFER_LENGTH)
+#define TMF8801_I2C_BUFFER_LENGTH I2C_BUFFER_LENGTH
+#elif defined(BUFFER_LENGTH)
+#define TMF8801_I2C_BUFFER_LENGTH BUFFER_LENGTH
+#else
+#define TMF8801_I2C_BUFFER_LENGTH 32
+#endif
+
+// Serializes register transactions of several TMF8801 instances sharing one bus from different
+// threads. Implement lock() and unlock() with the RTOS primitive of your platform.
+class TMF8801_BusArbiter
+{
+public:
+	virtual ~TMF8801_BusArbiter() {}
+
+	// Blocks until the caller owns the bus
+	virtual void lock() = 0;
+
+	// Releases the bus
+	virtual void unlock() = 0;
+};
+
+#if defined(ARDUINO_ARCH_ESP32)
+// Bus arbiter based on a FreeRTOS mutex
+class TMF8801_MutexBusArbiter : public TMF8801_BusArbiter
+{
+private:
+	SemaphoreHandle_t mutex;
+
+public:
+	TMF8801_MutexBusArbiter() { mutex = xSemaphoreCreateMutex(); }
+	void lock() { xSemaphoreTake(mutex, portMAX_DELAY); }
+	void unlock() { xSemaphoreGive(mutex); }
+};
+#endif
+
+// Bus usage accumulated since the last statistics reset
+struct TMF8801_BusStatistics
+{
+	// Number of I2C transactions (START to STOP)
+	unsigned long transactions;
+
+	// Bytes sent by the host, not counting address bytes
+	unsigned long bytesWritten;
+
+	// Bytes clocked in from the device, not counting address bytes
+	unsigned long bytesRead;
+
+	// Milliseconds spent waiting in delay() between transactions
+	unsigned long delayMillis;
+
+	// Microseconds spent waiting for the bus arbiter, in total and for the longest wait
+	unsigned long arbitrationWaitMicros;
+	unsigned long arbitrationWaitMaxMicros;
+};
+
 class TMF8801_IO
 {
 private:
 	TwoWire* _i2cPort;
 	byte _address;
 
+	// Bus usage counters
+	TMF8801_BusStatistics _statistics = { 0, 0, 0, 0, 0, 0 };
+
+	// Optional arbiter shared with other instances on the same bus
+	TMF8801_BusArbiter* _arbiter = NULL;
+
+	// Nesting depth of lockBus() calls, so read-modify-write sequences are locked only once
+	byte _lockDepth = 0;
+
+	// Acquires the bus arbiter, if any, and accounts the time spent waiting.
+	void lockBus();
+
+	// Releases the bus arbiter, if any.
+	void unlockBus();
+
 public:
 	// Default constructor.
 	TMF8801_IO() {}
@@ -36,6 +113,9 @@ public:
 	// Starts two wire interface.
 	bool begin(byte address, TwoWire& wirePort);
 
+	// Sets the arbiter used to share the bus with other threads. Pass NULL to disable arbitration.
+	void setBusArbiter(TMF8801_BusArbiter* arbiter);
+
 	// Returns true if we get a reply from the I2C device.
 	bool isConnected();
 
@@ -59,5 +139,14 @@ public:
 
 	// Returns true if a specific bit is set in a register. Bit position ranges from 0 (lsb) to 7 (msb).
 	bool isBitSet(byte registerAddress, byte bitPosition);
+
+	// Waits for the specified number of milliseconds and accounts it in the bus statistics.
+	void wait(unsigned long milliseconds);
+
+	// Returns bus usage accumulated since the last reset.
+	TMF8801_BusStatistics getStatistics();
+
+	// Clears bus usage counters.
+	void resetStatistics();
 };
 #endif
\ No newline at end of file
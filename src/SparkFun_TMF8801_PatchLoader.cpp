@@ -0,0 +1,297 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file downloads application patches through the TMF-8801 bootloader.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SparkFun_TMF8801_PatchLoader.h"
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+bool TMF8801_PatchLoader::fail(byte error)
+{
+	sensor.lastError = error;
+	return false;
+}
+
+bool TMF8801_PatchLoader::enterBootloader()
+{
+	frameSum = 0;
+	pendingLength = 0;
+	deviceAddress = 0;
+	addressKnown = false;
+	commandPending = false;
+	bytesDownloaded = 0;
+	downloadTime = 0;
+
+	// A CPU reset without an application request leaves the device in the bootloader
+	sensor.tmf8801_io.setRegisterBit(REGISTER_ENABLE_REG, CPU_RESET);
+	if (!sensor.cpuReady())
+		return fail(ERROR_CPU_RESET_TIMEOUT);
+	if (sensor.tmf8801_io.readSingleByte(REGISTER_APPID) != BOOTLOADER)
+		return fail(ERROR_BOOTLOADER_ERROR);
+
+	// Nothing is measuring while the bootloader runs
+	sensor.continuousMode = false;
+	sensor.singleShotPending = false;
+
+	transferStart = millis();
+	frame[0] = BL_COMMAND_DOWNLOAD_INIT;
+	frame[1] = 1;
+	frame[2] = BL_DOWNLOAD_INIT_SEED;
+	return sendFrame(frame, 1, BL_COMMAND_DOWNLOAD_INIT + 1 + BL_DOWNLOAD_INIT_SEED);
+}
+
+bool TMF8801_PatchLoader::waitReady()
+{
+	if (!commandPending)
+		return true;
+
+	// The bootloader answers with status, size and checksum. Anything but READY after
+	// the device finished means the frame was rejected.
+	byte status[3];
+	for (byte counter = 0; counter < BL_READY_TIMEOUT; counter++)
+	{
+		sensor.tmf8801_io.readMultipleBytes(REGISTER_BL_CMD_STAT, status, sizeof(status));
+		if (status[0] == BL_STATUS_READY)
+		{
+			commandPending = false;
+			return true;
+		}
+		// Values below 0x10 are final error codes, higher values mean busy
+		if (status[0] < 0x10)
+			return fail(ERROR_BOOTLOADER_ERROR);
+		sensor.tmf8801_io.wait(1);
+	}
+	return fail(ERROR_BOOTLOADER_ERROR);
+}
+
+bool TMF8801_PatchLoader::sendFrame(byte* frame, byte length, byte sum)
+{
+	// Wait for the previous frame only now, after this one has been prepared
+	if (!waitReady())
+		return false;
+
+	frame[length + 2] = ~sum;
+	sensor.tmf8801_io.writeMultipleBytes(REGISTER_BL_CMD_STAT, frame, length + 3);
+	commandPending = true;
+	return true;
+}
+
+bool TMF8801_PatchLoader::flush()
+{
+	if (pendingLength == 0)
+		return true;
+
+	// W_RAM writes continue where the previous one ended, so the address is only
+	// sent for the first chunk and when the image has a gap
+	if (!addressKnown || chunkAddress != deviceAddress)
+	{
+		byte addressFrame[5];
+		addressFrame[0] = BL_COMMAND_ADDR_RAM;
+		addressFrame[1] = 2;
+		addressFrame[2] = chunkAddress & 0xff;
+		addressFrame[3] = chunkAddress >> 8;
+		byte sum = BL_COMMAND_ADDR_RAM + 2 + addressFrame[2] + addressFrame[3];
+		if (!sendFrame(addressFrame, 2, sum))
+			return false;
+	}
+
+	frame[0] = BL_COMMAND_W_RAM;
+	frame[1] = pendingLength;
+	if (!sendFrame(frame, pendingLength, frameSum + BL_COMMAND_W_RAM + pendingLength))
+		return false;
+
+	deviceAddress = chunkAddress + pendingLength;
+	addressKnown = true;
+	bytesDownloaded += pendingLength;
+
+	// The next chunk is assembled while the device processes this one
+	pendingLength = 0;
+	frameSum = 0;
+	return true;
+}
+
+bool TMF8801_PatchLoader::appendByte(unsigned int address, byte value)
+{
+	if (pendingLength > 0 && (pendingLength == PATCH_CHUNK_LENGTH || address != (unsigned int)(chunkAddress + pendingLength)))
+	{
+		if (!flush())
+			return false;
+	}
+
+	if (pendingLength == 0)
+		chunkAddress = address;
+
+	frame[2 + pendingLength] = value;
+	frameSum += value;
+	pendingLength++;
+	return true;
+}
+
+bool TMF8801_PatchLoader::startApplication()
+{
+	if (!flush() || !waitReady())
+		return false;
+
+	// The transfer ends when the last frame was acknowledged
+	downloadTime = millis() - transferStart;
+
+	// Remap RAM to the patch and reset into it. The device does not acknowledge this command.
+	frame[0] = BL_COMMAND_RAMREMAP_RESET;
+	frame[1] = 0;
+	if (!sendFrame(frame, 0, BL_COMMAND_RAMREMAP_RESET))
+		return false;
+	commandPending = false;
+
+	// Verify that the patched application came up, then configure it as begin() does
+	if (!sensor.applicationReady())
+		return fail(ERROR_CPU_LOAD_APPLICATION_ERROR);
+
+	sensor.configureApplication();
+	sensor.lastError = ERROR_NONE;
+	return true;
+}
+
+byte TMF8801_PatchLoader::readImage(const void* pointer)
+{
+	if (imageInFlash)
+		return pgm_read_byte(pointer);
+	return *(const byte*)pointer;
+}
+
+bool TMF8801_PatchLoader::downloadBinary(const byte* image, unsigned long length, unsigned int address)
+{
+	imageInFlash = false;
+	return loadBinary(image, length, address);
+}
+
+bool TMF8801_PatchLoader::downloadBinary_P(const byte* image, unsigned long length, unsigned int address)
+{
+	imageInFlash = true;
+	return loadBinary(image, length, address);
+}
+
+bool TMF8801_PatchLoader::downloadIntelHex(const char* hex)
+{
+	imageInFlash = false;
+	return loadIntelHex(hex);
+}
+
+bool TMF8801_PatchLoader::downloadIntelHex_P(const char* hex)
+{
+	imageInFlash = true;
+	return loadIntelHex(hex);
+}
+
+bool TMF8801_PatchLoader::loadBinary(const byte* image, unsigned long length, unsigned int address)
+{
+	if (!enterBootloader())
+		return false;
+
+	for (unsigned long i = 0; i < length; i++)
+	{
+		if (!appendByte(address + i, readImage(image + i)))
+			return false;
+	}
+
+	return startApplication();
+}
+
+bool TMF8801_PatchLoader::parseHexByte(const char* text, byte& value)
+{
+	value = 0;
+	for (byte i = 0; i < 2; i++)
+	{
+		char c = readImage(text + i);
+		value <<= 4;
+		if (c >= '0' && c <= '9')
+			value |= c - '0';
+		else if (c >= 'A' && c <= 'F')
+			value |= c - 'A' + 10;
+		else if (c >= 'a' && c <= 'f')
+			value |= c - 'a' + 10;
+		else
+			return false;
+	}
+	return true;
+}
+
+bool TMF8801_PatchLoader::loadIntelHex(const char* hex)
+{
+	if (!enterBootloader())
+		return false;
+
+	while (true)
+	{
+		// Records start with ':', anything in between (line breaks) is skipped
+		while (readImage(hex) != ':' && readImage(hex) != 0)
+			hex++;
+		if (readImage(hex) == 0)
+			return fail(ERROR_PATCH_FORMAT_ERROR);
+		hex++;
+
+		// Record header: byte count, address and type
+		byte header[4];
+		for (byte i = 0; i < 4; i++, hex += 2)
+		{
+			if (!parseHexByte(hex, header[i]))
+				return fail(ERROR_PATCH_FORMAT_ERROR);
+		}
+		byte count = header[0];
+		unsigned int address = (header[1] << 8) | header[2];
+		byte type = header[3];
+		byte sum = header[0] + header[1] + header[2] + header[3];
+
+		// Data is streamed into the current chunk as it's parsed
+		for (byte i = 0; i < count; i++, hex += 2)
+		{
+			byte value;
+			if (!parseHexByte(hex, value))
+				return fail(ERROR_PATCH_FORMAT_ERROR);
+			sum += value;
+			if (type == 0x00 && !appendByte(address + i, value))
+				return false;
+		}
+
+		byte checksum;
+		if (!parseHexByte(hex, checksum) || (byte)(sum + checksum) != 0)
+			return fail(ERROR_PATCH_FORMAT_ERROR);
+		hex += 2;
+
+		// End of file record. Extended address records are ignored: the bootloader
+		// addresses RAM with 16 bits.
+		if (type == 0x01)
+			break;
+	}
+
+	return startApplication();
+}
+
+unsigned long TMF8801_PatchLoader::getBytesDownloaded()
+{
+	return bytesDownloaded;
+}
+
+unsigned long TMF8801_PatchLoader::getDownloadTime()
+{
+	return downloadTime;
+}
+
+unsigned long TMF8801_PatchLoader::getThroughput()
+{
+	if (downloadTime == 0)
+		return 0;
+	return (bytesDownloaded * 1000UL) / downloadTime;
+}
@@ -0,0 +1,126 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file downloads application patches through the TMF-8801 bootloader.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_LIBRARY_PATCH_LOADER__
+#define __TMF8801_LIBRARY_PATCH_LOADER__
+
+#include <Arduino.h>
+#include "SparkFun_TMF8801_Constants.h"
+#include "SparkFun_TMF8801_IO.h"
+
+class TMF8801;
+
+// Largest chunk that fits in one bootloader frame and one Wire transaction
+// (register address, command, size and checksum take 4 bytes)
+const byte PATCH_CHUNK_LENGTH = (TMF8801_I2C_BUFFER_LENGTH - 4 < BL_MAX_DATA_LENGTH) ? TMF8801_I2C_BUFFER_LENGTH - 4 : BL_MAX_DATA_LENGTH;
+
+// Downloads an application patch into TMF8801 RAM through the bootloader and starts it.
+// While the device processes one chunk the next one is assembled and checksummed, so the host
+// only waits for the device right before sending the next frame.
+// Every frame is checked by the bootloader against its checksum and the patched application
+// must report itself in APPID after the remap. RAM is not read back after the download.
+class TMF8801_PatchLoader
+{
+private:
+	TMF8801& sensor;
+
+	// Bootloader frame being assembled: command, size, data and checksum. Frames are sent
+	// synchronously, so it can be refilled as soon as it was written.
+	byte frame[PATCH_CHUNK_LENGTH + 3];
+
+	// Running sum of command, size and data bytes of the active frame
+	byte frameSum;
+
+	// Data bytes in the active frame and RAM address of the first one
+	byte pendingLength;
+	unsigned int chunkAddress;
+
+	// RAM address the bootloader will write next, once it has been set
+	unsigned int deviceAddress;
+	bool addressKnown;
+
+	// True while the last frame sent has not been acknowledged
+	bool commandPending;
+
+	// True while the image being downloaded is stored in flash (PROGMEM)
+	bool imageInFlash;
+
+	// Download statistics. Only the image transfer is timed, not reset and application start.
+	unsigned long bytesDownloaded;
+	unsigned long transferStart;
+	unsigned long downloadTime;
+
+	// Resets the device into the bootloader and initializes the download
+	bool enterBootloader();
+
+	// Waits until the bootloader acknowledges the last frame
+	bool waitReady();
+
+	// Completes the checksum of frame and sends it. Does not wait for the acknowledge.
+	bool sendFrame(byte* frame, byte length, byte sum);
+
+	// Adds a single byte to the current chunk, sending the chunk when it is full or not contiguous
+	bool appendByte(unsigned int address, byte value);
+
+	// Sends the pending chunk, preceded by an address command if needed
+	bool flush();
+
+	// Remaps RAM, waits until the patched application runs and configures it
+	bool startApplication();
+
+	// Marks the download as failed
+	bool fail(byte error);
+
+	// Returns the image byte at pointer, reading it from flash if needed
+	byte readImage(const void* pointer);
+
+	// Converts two hex digits of the image into a byte. Returns false on invalid characters.
+	bool parseHexByte(const char* text, byte& value);
+
+	// Download implementations shared by the RAM and flash versions
+	bool loadBinary(const byte* image, unsigned long length, unsigned int address);
+	bool loadIntelHex(const char* hex);
+
+public:
+	// Creates a loader for an initialized sensor
+	TMF8801_PatchLoader(TMF8801& tmf8801) : sensor(tmf8801) {}
+
+	// Downloads length bytes of a binary image to RAM starting at address, then starts it
+	bool downloadBinary(const byte* image, unsigned long length, unsigned int address);
+
+	// Same as downloadBinary() for an image stored in flash with PROGMEM
+	bool downloadBinary_P(const byte* image, unsigned long length, unsigned int address);
+
+	// Downloads a null-terminated Intel HEX image, then starts it
+	bool downloadIntelHex(const char* hex);
+
+	// Same as downloadIntelHex() for an image stored in flash with PROGMEM. Patch images usually
+	// don't fit in the RAM of AVR boards, so use this version there.
+	bool downloadIntelHex_P(const char* hex);
+
+	// Returns the number of image bytes sent by the last download
+	unsigned long getBytesDownloaded();
+
+	// Returns the time in milliseconds the last download spent transferring the image
+	unsigned long getDownloadTime();
+
+	// Returns the image transfer throughput of the last download in bytes per second
+	unsigned long getThroughput();
+};
+
+#endif
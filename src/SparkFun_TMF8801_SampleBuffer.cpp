@@ -0,0 +1,105 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file buffers TMF-8801 results for batch processing and multiple consumers.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SparkFun_TMF8801_SampleBuffer.h"
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+byte TMF8801_SampleBufferBase::getCapacity()
+{
+	return capacity;
+}
+
+bool TMF8801_SampleBufferBase::collectSample(TMF8801& sensor)
+{
+	if (!sensor.readNewMeasurement())
+		return false;
+
+	// Drop the oldest sample if the buffer is full
+	if (sampleHead - sampleTail == capacity)
+		sampleTail++;
+
+	byte index = sampleHead % capacity;
+	sampleDistances[index] = sensor.getLastDistance();
+	sampleReliabilities[index] = sensor.getMeasurementReliability();
+	sampleTimestamps[index] = millis();
+	sampleHead++;
+	return true;
+}
+
+byte TMF8801_SampleBufferBase::samplesAvailable()
+{
+	return sampleHead - sampleTail;
+}
+
+byte TMF8801_SampleBufferBase::readSamples(int* distances, byte* reliabilities, unsigned long* timestamps, byte maxCount)
+{
+	byte count = 0;
+	while (count < maxCount && sampleTail != sampleHead)
+	{
+		byte index = sampleTail % capacity;
+		if (distances != NULL)
+			distances[count] = sampleDistances[index];
+		if (reliabilities != NULL)
+			reliabilities[count] = sampleReliabilities[index];
+		if (timestamps != NULL)
+			timestamps[count] = sampleTimestamps[index];
+		sampleTail++;
+		count++;
+	}
+	return count;
+}
+
+void TMF8801_SampleBufferBase::initSampleCursor(TMF8801_SampleCursor& cursor)
+{
+	cursor.position = sampleHead;
+	cursor.dropped = 0;
+}
+
+byte TMF8801_SampleBufferBase::samplesAvailable(TMF8801_SampleCursor& cursor)
+{
+	unsigned long pending = sampleHead - cursor.position;
+	if (pending > capacity)
+		pending = capacity;
+	return pending;
+}
+
+byte TMF8801_SampleBufferBase::readSamples(TMF8801_SampleCursor& cursor, int* distances, byte* reliabilities, unsigned long* timestamps, byte maxCount)
+{
+	// Skip samples that were overwritten since this cursor last read
+	if (sampleHead - cursor.position > capacity)
+	{
+		unsigned long oldest = sampleHead - capacity;
+		cursor.dropped += oldest - cursor.position;
+		cursor.position = oldest;
+	}
+
+	byte count = 0;
+	while (count < maxCount && cursor.position != sampleHead)
+	{
+		byte index = cursor.position % capacity;
+		if (distances != NULL)
+			distances[count] = sampleDistances[index];
+		if (reliabilities != NULL)
+			reliabilities[count] = sampleReliabilities[index];
+		if (timestamps != NULL)
+			timestamps[count] = sampleTimestamps[index];
+		cursor.position++;
+		count++;
+	}
+	return count;
+}
@@ -0,0 +1,105 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file buffers TMF-8801 results for batch processing and multiple consumers.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_LIBRARY_SAMPLE_BUFFER__
+#define __TMF8801_LIBRARY_SAMPLE_BUFFER__
+
+#include <Arduino.h>
+
+class TMF8801;
+
+// Read position of one consumer of a sample buffer. Any number of cursors can read the same
+// samples independently of each other and of readSamples() without another bus access.
+struct TMF8801_SampleCursor
+{
+	// Sequence number of the next sample to read
+	unsigned long position;
+
+	// Samples overwritten before this consumer could read them
+	unsigned long dropped;
+};
+
+// Ring buffer logic shared by all buffer sizes. Declare a TMF8801_SampleBuffer<capacity> to get one
+// with its storage, so the capacity is fixed where the storage is and the library code never
+// depends on a size chosen by the sketch.
+class TMF8801_SampleBufferBase
+{
+private:
+	// Samples stored as separate arrays so they can be copied out contiguously
+	int* sampleDistances;
+	byte* sampleReliabilities;
+	unsigned long* sampleTimestamps;
+	byte capacity;
+
+	// Total number of samples collected and drained. Their difference is the buffer fill level.
+	unsigned long sampleHead = 0;
+	unsigned long sampleTail = 0;
+
+protected:
+	// Uses the given arrays of bufferCapacity elements as storage
+	TMF8801_SampleBufferBase(int* distances, byte* reliabilities, unsigned long* timestamps, byte bufferCapacity)
+		: sampleDistances(distances), sampleReliabilities(reliabilities), sampleTimestamps(timestamps), capacity(bufferCapacity) {}
+
+	// Storage belongs to the derived buffer, so copies would share it
+	TMF8801_SampleBufferBase(const TMF8801_SampleBufferBase&) = delete;
+	TMF8801_SampleBufferBase& operator=(const TMF8801_SampleBufferBase&) = delete;
+
+public:
+	// Returns the number of samples the buffer can hold
+	byte getCapacity();
+
+	// Reads a new result, if available, from sensor into the buffer. Returns true if a sample was
+	// added. When the buffer is full the oldest sample is overwritten.
+	bool collectSample(TMF8801& sensor);
+
+	// Returns the number of samples waiting in the buffer
+	byte samplesAvailable();
+
+	// Moves up to maxCount buffered samples, oldest first, into the caller's arrays and returns how
+	// many were copied. Timestamps are millis() values. Pass NULL for arrays you don't need.
+	byte readSamples(int* distances, byte* reliabilities, unsigned long* timestamps, byte maxCount);
+
+	// Positions cursor at the newest end of the buffer so it only sees samples collected from now on
+	void initSampleCursor(TMF8801_SampleCursor& cursor);
+
+	// Returns the number of samples cursor has not read yet
+	byte samplesAvailable(TMF8801_SampleCursor& cursor);
+
+	// Copies up to maxCount samples not yet seen by cursor, oldest first, and advances it. Samples
+	// stay in the buffer for other consumers. Returns how many were copied.
+	byte readSamples(TMF8801_SampleCursor& cursor, int* distances, byte* reliabilities, unsigned long* timestamps, byte maxCount);
+};
+
+// Ring buffer of Capacity (1 - 255) distance, reliability and timestamp samples filled from a
+// TMF8801. It is kept out of the TMF8801 class so only sketches that buffer samples pay for its RAM.
+template <byte Capacity>
+class TMF8801_SampleBuffer : public TMF8801_SampleBufferBase
+{
+	static_assert(Capacity > 0, "TMF8801_SampleBuffer needs a capacity of at least one sample");
+
+private:
+	int distances[Capacity];
+	byte reliabilities[Capacity];
+	unsigned long timestamps[Capacity];
+
+public:
+	// Default constructor
+	TMF8801_SampleBuffer() : TMF8801_SampleBufferBase(distances, reliabilities, timestamps, Capacity) {}
+};
+
+#endif
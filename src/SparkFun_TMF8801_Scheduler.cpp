@@ -0,0 +1,150 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file schedules single-shot measurements across co-located TMF-8801 sensors.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SparkFun_TMF8801_Scheduler.h"
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+bool TMF8801_Scheduler::addSensor(TMF8801& sensor)
+{
+	if (sensorCount == SCHEDULER_MAX_SENSORS)
+		return false;
+
+	sensors[sensorCount] = &sensor;
+	measurements[sensorCount] = 0;
+	timeouts[sensorCount] = 0;
+	sensorCount++;
+	return true;
+}
+
+void TMF8801_Scheduler::setSlotTimeout(unsigned long milliseconds)
+{
+	slotTimeout = milliseconds * 1000UL;
+}
+
+void TMF8801_Scheduler::setGuardTime(unsigned long microseconds)
+{
+	guardTime = microseconds;
+}
+
+void TMF8801_Scheduler::begin()
+{
+	// No sensor may keep ranging on its own once the schedule starts
+	for (byte i = 0; i < sensorCount; i++)
+		sensors[i]->stopMeasurement();
+
+	slotActive = false;
+	activeSensor = sensorCount - 1;
+	nextSlot = micros();
+	resetStatistics();
+}
+
+byte TMF8801_Scheduler::update()
+{
+	if (sensorCount == 0)
+		return SCHEDULER_NO_RESULT;
+
+	unsigned long now = micros();
+
+	if (slotActive)
+	{
+		TMF8801* sensor = sensors[activeSensor];
+		if (sensor->poll())
+		{
+			measurements[activeSensor]++;
+			endSlot(micros());
+			return activeSensor;
+		}
+
+		if (now - slotStart < slotTimeout)
+			return SCHEDULER_NO_RESULT;
+
+		// Make sure the late sensor stops emitting before the next one starts
+		sensor->stopMeasurement();
+		timeouts[activeSensor]++;
+		now = micros();
+		endSlot(now);
+	}
+
+	if ((long)(now - nextSlot) < 0)
+		return SCHEDULER_NO_RESULT;
+
+	// Round-robin to the next sensor
+	activeSensor++;
+	if (activeSensor >= sensorCount)
+		activeSensor = 0;
+
+	slotStart = micros();
+	sensors[activeSensor]->trigger();
+	slotActive = true;
+	return SCHEDULER_NO_RESULT;
+}
+
+void TMF8801_Scheduler::endSlot(unsigned long now)
+{
+	busyMicros += now - slotStart;
+	busyMillis += busyMicros / 1000;
+	busyMicros %= 1000;
+	slotActive = false;
+	nextSlot = now + guardTime;
+}
+
+float TMF8801_Scheduler::getMeasurementRate(byte index)
+{
+	if (index >= sensorCount)
+		return 0;
+
+	unsigned long elapsed = millis() - statisticsStart;
+	if (elapsed == 0)
+		return 0;
+	return measurements[index] * 1000.0 / elapsed;
+}
+
+unsigned long TMF8801_Scheduler::getTimeouts(byte index)
+{
+	if (index >= sensorCount)
+		return 0;
+	return timeouts[index];
+}
+
+float TMF8801_Scheduler::getAggregateRate()
+{
+	float rate = 0;
+	for (byte i = 0; i < sensorCount; i++)
+		rate += getMeasurementRate(i);
+	return rate;
+}
+
+float TMF8801_Scheduler::getSlotUtilisation()
+{
+	unsigned long elapsed = millis() - statisticsStart;
+	if (elapsed == 0)
+		return 0;
+	return (busyMillis + busyMicros / 1000.0) / elapsed;
+}
+
+void TMF8801_Scheduler::resetStatistics()
+{
+	for (byte i = 0; i < sensorCount; i++)
+	{
+		measurements[i] = 0;
+		timeouts[i] = 0;
+	}
+	busyMillis = 0;
+	busyMicros = 0;
+	statisticsStart = millis();
+}
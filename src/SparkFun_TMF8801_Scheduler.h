@@ -0,0 +1,104 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file schedules single-shot measurements across co-located TMF-8801 sensors.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_LIBRARY_SCHEDULER__
+#define __TMF8801_LIBRARY_SCHEDULER__
+
+#include <Arduino.h>
+
+// Maximum number of sensors handled by a single scheduler
+const byte SCHEDULER_MAX_SENSORS = 8;
+
+// Returned by update() when no sensor has a new result
+const byte SCHEDULER_NO_RESULT = 0xFF;
+
+class TMF8801;
+
+// Takes single-shot measurements on a group of sensors one at a time, so that no two sensors
+// emit at the same time. The next sensor is triggered as soon as the previous result is read.
+class TMF8801_Scheduler
+{
+private:
+	// Scheduled sensors
+	TMF8801* sensors[SCHEDULER_MAX_SENSORS];
+	byte sensorCount = 0;
+
+	// Results and timeouts per sensor since the last statistics reset
+	unsigned long measurements[SCHEDULER_MAX_SENSORS];
+	unsigned long timeouts[SCHEDULER_MAX_SENSORS];
+
+	// Sensor currently measuring
+	byte activeSensor = 0;
+	bool slotActive = false;
+
+	// micros() timestamps of the current slot start and of the earliest next slot start
+	unsigned long slotStart;
+	unsigned long nextSlot;
+
+	// Slot configuration in microseconds
+	unsigned long slotTimeout = 200000;
+	unsigned long guardTime = 0;
+
+	// Time spent in slots, in milliseconds plus the microseconds that don't make a full millisecond
+	// yet. Each slot is timed with micros(), so only the slot length has to fit in 32 bits.
+	unsigned long busyMillis;
+	unsigned long busyMicros;
+
+	// millis() timestamp of the last statistics reset
+	unsigned long statisticsStart;
+
+	// Ends the active slot at micros() timestamp now and adds it to the busy time
+	void endSlot(unsigned long now);
+
+public:
+	// Default constructor
+	TMF8801_Scheduler() {}
+
+	// Adds an initialized sensor to the group. Returns false if the group is full.
+	bool addSensor(TMF8801& sensor);
+
+	// Sets how long a sensor may take to deliver its result before it is skipped, in milliseconds
+	void setSlotTimeout(unsigned long milliseconds);
+
+	// Sets idle time between the end of one slot and the next trigger, in microseconds
+	void setGuardTime(unsigned long microseconds);
+
+	// Stops continuous ranging on all sensors and starts the schedule
+	void begin();
+
+	// Advances the schedule. Call it as often as possible. Returns the index of the sensor whose
+	// result was just read, so it can be fetched with getLastDistance(), or SCHEDULER_NO_RESULT.
+	byte update();
+
+	// Returns the measurement rate achieved by a sensor in Hz
+	float getMeasurementRate(byte index);
+
+	// Returns the number of slots in which a sensor did not deliver a result in time
+	unsigned long getTimeouts(byte index);
+
+	// Returns the measurement rate of the whole group in Hz
+	float getAggregateRate();
+
+	// Returns the fraction of time (0 - 1) in which a sensor was measuring
+	float getSlotUtilisation();
+
+	// Clears rates, timeouts and utilisation
+	void resetStatistics();
+};
+
+#endif
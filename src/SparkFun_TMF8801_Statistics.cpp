@@ -0,0 +1,113 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file implements reductions over arrays of TMF-8801 samples.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SparkFun_TMF8801_Statistics.h"
+
+int TMF8801_Statistics::minimum(const int* distances, unsigned int count)
+{
+	if (count == 0)
+		return 0;
+
+	int result = distances[0];
+	for (unsigned int i = 1; i < count; i++)
+		result = distances[i] < result ? distances[i] : result;
+	return result;
+}
+
+int TMF8801_Statistics::maximum(const int* distances, unsigned int count)
+{
+	if (count == 0)
+		return 0;
+
+	int result = distances[0];
+	for (unsigned int i = 1; i < count; i++)
+		result = distances[i] > result ? distances[i] : result;
+	return result;
+}
+
+float TMF8801_Statistics::mean(const int* distances, unsigned int count)
+{
+	if (count == 0)
+		return 0;
+
+	long sum = 0;
+	for (unsigned int i = 0; i < count; i++)
+		sum += distances[i];
+	return (float)sum / count;
+}
+
+float TMF8801_Statistics::weightedMean(const int* distances, const byte* reliabilities, unsigned int count)
+{
+	long sum = 0;
+	long weights = 0;
+	for (unsigned int i = 0; i < count; i++)
+	{
+		sum += (long)distances[i] * reliabilities[i];
+		weights += reliabilities[i];
+	}
+
+	if (weights == 0)
+		return 0;
+	return (float)sum / weights;
+}
+
+int TMF8801_Statistics::percentile(int* distances, unsigned int count, byte percentile)
+{
+	if (count == 0)
+		return 0;
+	if (percentile > 100)
+		percentile = 100;
+
+	// Nearest-rank position of the requested percentile
+	unsigned int target = ((unsigned long)percentile * (count - 1) + 50) / 100;
+
+	// Quickselect: partition around a pivot until the target position is in place
+	unsigned int left = 0;
+	unsigned int right = count - 1;
+	while (left < right)
+	{
+		int pivot = distances[left + (right - left) / 2];
+		unsigned int i = left;
+		unsigned int j = right;
+		while (i <= j)
+		{
+			while (distances[i] < pivot)
+				i++;
+			while (distances[j] > pivot)
+				j--;
+			if (i <= j)
+			{
+				int swap = distances[i];
+				distances[i] = distances[j];
+				distances[j] = swap;
+				i++;
+				if (j == 0)
+					break;
+				j--;
+			}
+		}
+
+		if (target <= j)
+			right = j;
+		else if (target >= i)
+			left = i;
+		else
+			break;
+	}
+	return distances[target];
+}
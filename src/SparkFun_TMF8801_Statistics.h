@@ -0,0 +1,46 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file implements reductions over arrays of TMF-8801 samples.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_LIBRARY_STATISTICS__
+#define __TMF8801_LIBRARY_STATISTICS__
+
+#include <Arduino.h>
+
+// Reductions over the arrays filled by TMF8801_SampleBuffer::readSamples(). The loops are kept free of
+// data-dependent branches so host compilers can vectorize them.
+class TMF8801_Statistics
+{
+public:
+	// Returns the smallest distance. Returns 0 if count is 0.
+	static int minimum(const int* distances, unsigned int count);
+
+	// Returns the largest distance. Returns 0 if count is 0.
+	static int maximum(const int* distances, unsigned int count);
+
+	// Returns the mean distance. Returns 0 if count is 0.
+	static float mean(const int* distances, unsigned int count);
+
+	// Returns the mean distance weighted by measurement reliability. Returns 0 if all weights are 0.
+	static float weightedMean(const int* distances, const byte* reliabilities, unsigned int count);
+
+	// Returns the distance below which percentile percent (0 - 100) of the samples fall.
+	// The distances array is partially reordered. Returns 0 if count is 0.
+	static int percentile(int* distances, unsigned int count, byte percentile);
+};
+
+#endif
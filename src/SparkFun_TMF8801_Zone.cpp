@@ -0,0 +1,141 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file turns TMF-8801 distance samples into zone enter/exit events.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SparkFun_TMF8801_Zone.h"
+#include "SparkFun_TMF8801_Arduino_Library.h"
+
+void TMF8801_Zone::setBand(int nearDistance, int farDistance)
+{
+	nearLimit = nearDistance;
+	farLimit = farDistance;
+}
+
+void TMF8801_Zone::setHysteresis(int distance)
+{
+	hysteresis = distance;
+}
+
+void TMF8801_Zone::setChangeThreshold(int distance)
+{
+	changeThreshold = distance;
+}
+
+void TMF8801_Zone::setMinimumDwell(unsigned long milliseconds)
+{
+	minimumDwell = milliseconds;
+}
+
+void TMF8801_Zone::setMinimumReliability(byte reliability)
+{
+	minimumReliability = reliability;
+}
+
+void TMF8801_Zone::onEvent(TMF8801_ZoneCallback eventCallback)
+{
+	callback = eventCallback;
+}
+
+void TMF8801_Zone::attachOutput(TMF8801& sensor, byte gpio)
+{
+	outputSensor = &sensor;
+	outputGPIO = gpio;
+
+	// Bring the output to the current state
+	notify(ZONE_EVENT_NONE, reportedDistance);
+}
+
+void TMF8801_Zone::detachOutput()
+{
+	outputSensor = NULL;
+}
+
+bool TMF8801_Zone::isInside()
+{
+	return inside;
+}
+
+byte TMF8801_Zone::update(TMF8801& sensor)
+{
+	// The same result must not be fed twice or it would count towards the dwell time
+	if (!sensor.readNewMeasurement())
+		return ZONE_EVENT_NONE;
+
+	return update(sensor.getLastDistance(), sensor.getMeasurementReliability());
+}
+
+byte TMF8801_Zone::update(int distance, byte reliability)
+{
+	// Weak detections neither change the state nor restart the dwell timer
+	if (reliability != 0 && reliability < minimumReliability)
+		return ZONE_EVENT_NONE;
+
+	// Entering requires the target to be inside the band, leaving requires it to be
+	// further than hysteresis away from it or gone altogether
+	bool sampleInside;
+	if (reliability == 0)
+		sampleInside = false;
+	else if (inside)
+		sampleInside = (distance >= nearLimit - hysteresis) && (distance <= farLimit + hysteresis);
+	else
+		sampleInside = (distance >= nearLimit) && (distance <= farLimit);
+
+	if (sampleInside == inside)
+	{
+		// State confirmed, drop any pending change
+		candidatePending = false;
+
+		if (inside && changeThreshold > 0 && abs(distance - reportedDistance) >= changeThreshold)
+			return notify(ZONE_EVENT_CHANGED, distance);
+
+		return ZONE_EVENT_NONE;
+	}
+
+	// State differs from the reported one - wait until it has been stable for minimumDwell
+	unsigned long now = millis();
+	if (!candidatePending)
+	{
+		candidatePending = true;
+		candidateStart = now;
+	}
+	if (now - candidateStart < minimumDwell)
+		return ZONE_EVENT_NONE;
+
+	candidatePending = false;
+	inside = sampleInside;
+	return notify(inside ? ZONE_EVENT_ENTER : ZONE_EVENT_EXIT, distance);
+}
+
+byte TMF8801_Zone::notify(byte event, int distance)
+{
+	reportedDistance = distance;
+
+	// Only touch the bus when the output has to change
+	if (outputSensor != NULL && event != ZONE_EVENT_CHANGED)
+	{
+		byte mode = inside ? MODE_HIGH_OUTPUT : MODE_LOW_OUTPUT;
+		if (outputGPIO == 0)
+			outputSensor->setGPIO0Mode(mode);
+		else
+			outputSensor->setGPIO1Mode(mode);
+	}
+
+	if (callback != NULL && event != ZONE_EVENT_NONE)
+		callback(event, distance);
+
+	return event;
+}
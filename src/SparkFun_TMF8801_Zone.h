@@ -0,0 +1,106 @@
+/*
+  This is a library written for the AMS TMF-8801 Time-of-flight sensor
+  SparkFun sells these at its website:
+  https://www.sparkfun.com/products/17716
+
+  Do you like this library? Help support open source hardware. Buy a board!
+
+  SparkFun Electronics, October 18th, 2026
+  This file turns TMF-8801 distance samples into zone enter/exit events.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TMF8801_LIBRARY_ZONE__
+#define __TMF8801_LIBRARY_ZONE__
+
+#include <Arduino.h>
+#include "SparkFun_TMF8801_Constants.h"
+
+class TMF8801;
+
+// Called with ZONE_EVENT_ENTER, ZONE_EVENT_EXIT or ZONE_EVENT_CHANGED and the distance that caused it
+typedef void (*TMF8801_ZoneCallback)(byte event, int distance);
+
+class TMF8801_Zone
+{
+private:
+	// Zone boundaries in millimeters
+	int nearLimit = 0;
+	int farLimit = 0;
+
+	// Distance in millimeters a target must move past a boundary before it exits the zone
+	int hysteresis = 0;
+
+	// Distance change in millimeters inside the zone that generates ZONE_EVENT_CHANGED. 0 disables it.
+	int changeThreshold = 0;
+
+	// Time in milliseconds a new state must persist before it is reported
+	unsigned long minimumDwell = 0;
+
+	// Samples with a lower reliability are ignored
+	byte minimumReliability = 0;
+
+	// Reported state
+	bool inside = false;
+	int reportedDistance = 0;
+
+	// State waiting for minimumDwell to elapse
+	bool candidatePending = false;
+	unsigned long candidateStart;
+
+	// Event receiver
+	TMF8801_ZoneCallback callback = NULL;
+
+	// Optional TMF8801 GPIO driven high while a target is inside the zone
+	TMF8801* outputSensor = NULL;
+	byte outputGPIO;
+
+	// Reports event to callback and updates output GPIO
+	byte notify(byte event, int distance);
+
+public:
+	// Default constructor
+	TMF8801_Zone() {}
+
+	// Sets zone boundaries in millimeters
+	void setBand(int nearDistance, int farDistance);
+
+	// Sets how far in millimeters a target must move beyond a boundary to leave the zone
+	void setHysteresis(int distance);
+
+	// Sets distance change in millimeters that generates ZONE_EVENT_CHANGED while inside the zone. 0 disables it.
+	void setChangeThreshold(int distance);
+
+	// Sets time in milliseconds a state change must persist before it is reported
+	void setMinimumDwell(unsigned long milliseconds);
+
+	// Sets minimum measurement reliability (1 - 63). Weaker detections are ignored, while reliability 0
+	// means no target was found and always counts as outside the zone.
+	void setMinimumReliability(byte reliability);
+
+	// Sets function called on every event
+	void onEvent(TMF8801_ZoneCallback eventCallback);
+
+	// Drives sensor's GPIO0 (gpio = 0) or GPIO1 (gpio = 1) high while a target is inside the zone
+	void attachOutput(TMF8801& sensor, byte gpio);
+
+	// Stops driving the attached GPIO
+	void detachOutput();
+
+	// Feeds a new sample. Returns the generated event or ZONE_EVENT_NONE.
+	byte update(int distance, byte reliability);
+
+	// Feeds sensor's result if a new one is available. Returns the generated event or ZONE_EVENT_NONE.
+	byte update(TMF8801& sensor);
+
+	// Returns true if a target is currently reported inside the zone
+	bool isInside();
+};
+
+#endif